@@ -0,0 +1,110 @@
+﻿#include "Animacion.hpp"
+#include "raylib.h"
+#include <cmath>
+
+// ============================================================================
+// TABLAS DE CUADROS (constantes, compartidas por todas las instancias)
+// ============================================================================
+// Caballero: respira quieto, rebota al correr y se estira al saltar
+static const CuadroAnimacion CuadrosQuieto[] = {
+    { 0, 1.00f, 0.00f },
+    { 0, 0.98f, 0.00f }
+};
+
+static const CuadroAnimacion CuadrosCorre[] = {
+    { 0, 1.00f, 0.00f },
+    { 0, 0.97f, 0.00f },
+    { 0, 1.00f, -0.03f },
+    { 0, 0.97f, 0.00f }
+};
+
+static const CuadroAnimacion CuadrosSalta[] = {
+    { 0, 1.06f, 0.00f },
+    { 0, 1.02f, 0.00f }
+};
+
+// Murciélago: aleteo (se aplasta sin moverse del centro)
+static const CuadroAnimacion CuadrosAleteo[] = {
+    { 0, 1.00f, 0.00f },
+    { 0, 0.80f, -0.10f },
+    { 0, 0.60f, -0.20f },
+    { 0, 0.80f, -0.10f }
+};
+
+// En el mismo orden que IdClip
+static const ClipAnimacion Clips[CLIP_CANTIDAD] = {
+    { TEX_CABALLERO,  CuadrosQuieto, 2, 0.50f, true  },  // CLIP_CABALLERO_QUIETO
+    { TEX_CABALLERO,  CuadrosCorre,  4, 0.10f, true  },  // CLIP_CABALLERO_CORRE
+    { TEX_CABALLERO,  CuadrosSalta,  2, 0.12f, false },  // CLIP_CABALLERO_SALTA
+    { TEX_MURCIELAGO, CuadrosAleteo, 4, 0.08f, true  }   // CLIP_MURCIELAGO_ALETEO
+};
+
+// ============================================================================
+// ESTADO
+// ============================================================================
+const ClipAnimacion& ObtenerClip(IdClip clip)
+{
+    return Clips[clip];
+}
+
+void IniciarAnimacion(EstadoAnimacion& a, IdClip clip, float desfase)
+{
+    a.Clip = clip;
+    a.Tiempo = 0;
+    AvanzarAnimacion(a, desfase);
+}
+
+void CambiarClip(EstadoAnimacion& a, IdClip clip)
+{
+    if (a.Clip != clip) IniciarAnimacion(a, clip);
+}
+
+// El tiempo se mantiene dentro de la duración del clip: no pierde
+// precisión por más que el juego quede abierto horas.
+void AvanzarAnimacion(EstadoAnimacion& a, float dt)
+{
+    const ClipAnimacion& clip = Clips[a.Clip];
+    float duracion = clip.NumCuadros * clip.DuracionCuadro;
+
+    a.Tiempo += dt;
+    if (a.Tiempo >= duracion)
+        a.Tiempo = clip.Bucle ? std::fmod(a.Tiempo, duracion) : duracion;
+}
+
+const CuadroAnimacion& CuadroActual(const EstadoAnimacion& a)
+{
+    const ClipAnimacion& clip = Clips[a.Clip];
+    int cuadro = (int)(a.Tiempo / clip.DuracionCuadro);
+    if (cuadro >= clip.NumCuadros) cuadro = clip.NumCuadros - 1;
+    return clip.Cuadros[cuadro];
+}
+
+// ============================================================================
+// DIBUJO
+// ============================================================================
+void RectangulosCuadro(IdTextura hoja, const CuadroAnimacion& cuadro, Vector2 posicion,
+                       float escala, bool espejado, Rectangle& fuente, Rectangle& destino)
+{
+    float ancho = Recursos::AnchoCuadro(hoja) * escala;
+    float alto = Recursos::AltoCuadro(hoja) * escala;
+    float altoDibujo = alto * cuadro.EscalaY;
+
+    fuente = Recursos::Cuadro(hoja, cuadro.Celda);
+    if (espejado) fuente.width = -fuente.width;
+
+    destino = { posicion.x, posicion.y + alto - altoDibujo + alto * cuadro.DesplazY, ancho, altoDibujo };
+}
+
+void DibujarCuadro(const Texture2D& textura, IdTextura hoja, const CuadroAnimacion& cuadro,
+                   Vector2 posicion, float escala, bool espejado, Color tinte)
+{
+    Rectangle fuente, destino;
+    RectangulosCuadro(hoja, cuadro, posicion, escala, espejado, fuente, destino);
+    DrawTexturePro(textura, fuente, destino, { 0, 0 }, 0, tinte);
+}
+
+void DibujarAnimacion(const EstadoAnimacion& a, Vector2 posicion, float escala, bool espejado)
+{
+    IdTextura hoja = Clips[a.Clip].Hoja;
+    DibujarCuadro(Recursos::Textura(hoja), hoja, CuadroActual(a), posicion, escala, espejado);
+}
@@ -0,0 +1,75 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Recursos.hpp"
+
+// ============================================================================
+// CLIPS DE ANIMACIÓN
+// ============================================================================
+// Las tablas de cuadros son constantes y compartidas: cada instancia solo
+// guarda qué clip reproduce y cuánto tiempo lleva (EstadoAnimacion).
+// ============================================================================
+enum IdClip : unsigned char
+{
+    CLIP_CABALLERO_QUIETO,
+    CLIP_CABALLERO_CORRE,
+    CLIP_CABALLERO_SALTA,
+    CLIP_MURCIELAGO_ALETEO,
+    CLIP_CANTIDAD
+};
+
+// Un cuadro: celda de la hoja y un ajuste del dibujo (los sprites actuales
+// son de un solo dibujo; el ajuste es lo que los hace moverse)
+struct CuadroAnimacion
+{
+    unsigned char Celda;        // Cuadro de la hoja (Recursos::Cuadro)
+    float EscalaY;              // Estiramiento vertical, apoyado en la base
+    float DesplazY;             // Corrimiento vertical, en fracción del alto del cuadro
+};
+
+struct ClipAnimacion
+{
+    IdTextura Hoja;                     // Hoja de sprites de donde salen los cuadros
+    const CuadroAnimacion* Cuadros;
+    unsigned char NumCuadros;
+    float DuracionCuadro;               // Segundos por cuadro
+    bool Bucle;                         // Si no, queda en el último cuadro
+};
+
+// Estado por instancia (8 bytes, copiable sin riesgo)
+struct EstadoAnimacion
+{
+    IdClip Clip;
+    float Tiempo;               // Segundos desde que empezó el clip
+};
+
+// ============================================================================
+// OPERACIONES
+// ============================================================================
+// Tabla compartida del clip
+const ClipAnimacion& ObtenerClip(IdClip clip);
+
+// Empieza 'clip' con 'desfase' segundos ya transcurridos
+void IniciarAnimacion(EstadoAnimacion& a, IdClip clip, float desfase = 0);
+
+// Cambia de clip; si ya estaba en ese, sigue sin reiniciarlo
+void CambiarClip(EstadoAnimacion& a, IdClip clip);
+
+// Avanza el tiempo (los clips en bucle vuelven a empezar)
+void AvanzarAnimacion(EstadoAnimacion& a, float dt);
+
+// Cuadro que corresponde al tiempo actual
+const CuadroAnimacion& CuadroActual(const EstadoAnimacion& a);
+
+// Rectángulos fuente (en la hoja) y destino (en pantalla) de un cuadro
+// con la esquina superior izquierda en 'posicion'
+void RectangulosCuadro(IdTextura hoja, const CuadroAnimacion& cuadro, Vector2 posicion,
+                       float escala, bool espejado, Rectangle& fuente, Rectangle& destino);
+
+// Dibuja un cuadro de 'hoja' con la esquina superior izquierda en 'posicion'.
+// 'espejado' invierte el rectángulo fuente (sin cambiar de textura, así
+// varias instancias siguen en el mismo lote de raylib).
+void DibujarCuadro(const Texture2D& textura, IdTextura hoja, const CuadroAnimacion& cuadro,
+                   Vector2 posicion, float escala, bool espejado, Color tinte = WHITE);
+
+// Dibuja el cuadro actual de una instancia
+void DibujarAnimacion(const EstadoAnimacion& a, Vector2 posicion, float escala, bool espejado);
@@ -0,0 +1,64 @@
+﻿#include "Arena.hpp"
+#include "raylib.h"
+#include <cstdlib>
+#include <cstring>
+
+// ============================================================================
+// CONSTRUCTOR: reserva el bloque completo de una sola vez
+// ============================================================================
+ArenaNivel::ArenaNivel(size_t capacidad)
+{
+    Memoria = static_cast<unsigned char*>(std::malloc(capacidad));
+    Tamanio = Memoria ? capacidad : 0;
+    Desplazamiento = 0;
+    Pico = 0;
+}
+
+// ============================================================================
+// RESERVA LINEAL (avanza el desplazamiento respetando la alineación)
+// ============================================================================
+void* ArenaNivel::Reservar(size_t bytes, size_t alineacion)
+{
+    size_t inicio = (Desplazamiento + alineacion - 1) & ~(alineacion - 1);
+
+    if (inicio + bytes > Tamanio)
+    {
+        TraceLog(LOG_WARNING, "ARENA: sin espacio (%zu bytes pedidos, %zu/%zu usados)",
+            bytes, Desplazamiento, Tamanio);
+        return nullptr;
+    }
+
+    Desplazamiento = inicio + bytes;
+    if (Desplazamiento > Pico) Pico = Desplazamiento;
+
+    return Memoria + inicio;
+}
+
+// ============================================================================
+// COPIA DE TEXTOS (nombres de nivel, carteles, etc.)
+// ============================================================================
+const char* ArenaNivel::CopiarTexto(const char* texto)
+{
+    size_t largo = std::strlen(texto) + 1;
+
+    char* copia = static_cast<char*>(Reservar(largo, 1));
+    if (copia) std::memcpy(copia, texto, largo);
+
+    return copia;
+}
+
+// ============================================================================
+// REINICIO: descarta todo el contenido en O(1)
+// ============================================================================
+void ArenaNivel::Reiniciar()
+{
+    Desplazamiento = 0;
+}
+
+// ============================================================================
+// DESTRUCTOR: libera el bloque
+// ============================================================================
+ArenaNivel::~ArenaNivel()
+{
+    std::free(Memoria);
+}
@@ -0,0 +1,68 @@
+﻿#pragma once
+#include <cstddef>
+#include <new>
+
+// ============================================================================
+// CLASE ARENA DE NIVEL
+// ============================================================================
+// Bloque de memoria lineal que respalda todos los datos de un nivel:
+// colisionadores, arreglos de enemigos, tablas de aparición y textos.
+// Las reservas solo avanzan un desplazamiento; no hay liberación individual.
+// Todo se descarta de una sola vez con Reiniciar() al cambiar de nivel
+// o al reintentar, sin fragmentación ni destructores por objeto.
+// ============================================================================
+class ArenaNivel
+{
+public:
+    // Reserva el bloque completo una única vez al crear la arena
+    explicit ArenaNivel(size_t capacidad);
+
+    // Libera el bloque completo
+    ~ArenaNivel();
+
+    // Reserva 'bytes' alineados. Devuelve nullptr si no hay lugar.
+    void* Reservar(size_t bytes, size_t alineacion = alignof(std::max_align_t));
+
+    // Reserva un arreglo de 'cantidad' elementos construidos por defecto
+    template <typename T>
+    T* ReservarArreglo(int cantidad)
+    {
+        if (cantidad <= 0) return nullptr;
+
+        void* memoria = Reservar(sizeof(T) * (size_t)cantidad, alignof(T));
+        if (!memoria) return nullptr;
+
+        T* arreglo = static_cast<T*>(memoria);
+        for (int i = 0; i < cantidad; i++) new (&arreglo[i]) T();
+        return arreglo;
+    }
+
+    // Construye un objeto dentro de la arena
+    template <typename T, typename... Args>
+    T* Crear(Args... args)
+    {
+        void* memoria = Reservar(sizeof(T), alignof(T));
+        return memoria ? new (memoria) T(args...) : nullptr;
+    }
+
+    // Copia un texto terminado en '\0' dentro de la arena
+    const char* CopiarTexto(const char* texto);
+
+    // Descarta todo lo reservado (vuelve el desplazamiento a cero)
+    void Reiniciar();
+
+    // Estadísticas de uso
+    size_t BytesUsados() const { return Desplazamiento; }
+    size_t BytesPico() const { return Pico; }
+    size_t Capacidad() const { return Tamanio; }
+
+private:
+    unsigned char* Memoria;     // Bloque reservado al inicio
+    size_t Tamanio;             // Capacidad total en bytes
+    size_t Desplazamiento;      // Próximo byte libre
+    size_t Pico;                // Máximo desplazamiento alcanzado
+
+    // La arena es dueña de su bloque: no se copia
+    ArenaNivel(const ArenaNivel&) = delete;
+    ArenaNivel& operator=(const ArenaNivel&) = delete;
+};
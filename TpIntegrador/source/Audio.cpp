@@ -0,0 +1,266 @@
+﻿#include "Audio.hpp"
+#include "raylib.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// ============================================================================
+// CONFIGURACIÓN DE CADA SONIDO (en el mismo orden que IdSonido)
+// ============================================================================
+struct ConfigSonido
+{
+    const char* Ruta;
+    int Voces;                  // Cuántas reproducciones simultáneas admite
+    int PresupuestoFrame;       // Máximo de disparos por frame
+};
+
+static const ConfigSonido Configuracion[SND_CANTIDAD] = {
+    { "Caminando.mp3",  4, 1 },     // SND_CAMINAR_PASTO
+    { "CaeCaja.mp3",    4, 1 },     // SND_CAMINAR_CAJA
+    { "SaltoPasto.mp3", 3, 1 },     // SND_SALTO_PASTO
+    { "SaltoCaja.mp3",  3, 1 },     // SND_SALTO_CAJA
+    { "Boton.mp3",      2, 2 },     // SND_BOTON
+    { "TocaBoton.mp3",  2, 1 },     // SND_TOCA_BOTON
+    { "Pierde.mp3",     1, 1 },     // SND_PIERDE
+    { "Ganaste.mp3",    1, 1 }      // SND_GANASTE
+};
+
+// Límite global de disparos por frame (los de prioridad ALTA no cuentan)
+static const int PresupuestoGlobalFrame = 6;
+
+// ============================================================================
+// POOL DE VOCES (arreglos fijos, sin reservas al reproducir)
+// ============================================================================
+// Después de Iniciar() estos datos solo los toca el hilo de audio.
+static const int MaxVoces = 32;
+
+struct Voz
+{
+    Sound Sonido;
+    unsigned int Orden;             // Número de disparo (menor = más vieja)
+    PrioridadSonido Prioridad;
+};
+
+static Voz Voces[MaxVoces] = {};
+static int PrimeraVoz[SND_CANTIDAD] = {};      // Índice de la primera voz de cada sonido
+static int CantidadVoces[SND_CANTIDAD] = {};
+
+static int DisparosSonido[SND_CANTIDAD] = {};  // Disparos en el frame actual
+static int DisparosFrame = 0;
+static unsigned int ContadorDisparos = 0;
+
+// ============================================================================
+// COLA DE COMANDOS (un productor: el hilo principal; un consumidor: el hilo de audio)
+// ============================================================================
+// Buffer circular sin locks: el hilo principal solo escribe 'Cabeza',
+// el hilo de audio solo escribe 'Cola'. Si la cola se llena, el comando
+// se descarta (nunca se bloquea el frame).
+// ============================================================================
+enum TipoComandoAudio : unsigned char
+{
+    CMD_REPRODUCIR,
+    CMD_NUEVO_FRAME
+};
+
+struct ComandoAudio
+{
+    TipoComandoAudio Tipo;
+    IdSonido Id;
+    PrioridadSonido Prioridad;
+};
+
+static const unsigned int CapacidadCola = 256;     // Potencia de 2
+
+static ComandoAudio Cola[CapacidadCola];
+static std::atomic<unsigned int> Cabeza{ 0 };       // Próximo lugar a escribir
+static std::atomic<unsigned int> Final{ 0 };        // Próximo lugar a leer
+static std::atomic<unsigned int> Descartados{ 0 };
+
+static bool Encolar(const ComandoAudio& cmd)
+{
+    unsigned int cabeza = Cabeza.load(std::memory_order_relaxed);
+
+    if (cabeza - Final.load(std::memory_order_acquire) >= CapacidadCola)
+    {
+        Descartados.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Cola[cabeza & (CapacidadCola - 1)] = cmd;
+    Cabeza.store(cabeza + 1, std::memory_order_release);
+    return true;
+}
+
+static bool Desencolar(ComandoAudio& cmd)
+{
+    unsigned int final = Final.load(std::memory_order_relaxed);
+
+    if (final == Cabeza.load(std::memory_order_acquire)) return false;
+
+    cmd = Cola[final & (CapacidadCola - 1)];
+    Final.store(final + 1, std::memory_order_release);
+    return true;
+}
+
+// ============================================================================
+// ESTADO DEL HILO DE AUDIO
+// ============================================================================
+static std::thread HiloAudio;
+static std::atomic<bool> Activo{ false };
+static Music Musica = {};
+static bool HayMusica = false;
+
+// ============================================================================
+// LÓGICA DEL POOL (solo se ejecuta en el hilo de audio)
+// ============================================================================
+static void ReiniciarPresupuesto()
+{
+    for (int i = 0; i < SND_CANTIDAD; i++) DisparosSonido[i] = 0;
+    DisparosFrame = 0;
+}
+
+static void DispararVoz(IdSonido id, PrioridadSonido prioridad)
+{
+    // --- Presupuesto por frame (evita saturar el mezclador) ---
+    if (prioridad < PRIORIDAD_ALTA)
+    {
+        if (DisparosFrame >= PresupuestoGlobalFrame) return;
+        if (DisparosSonido[id] >= Configuracion[id].PresupuestoFrame) return;
+    }
+
+    // --- Elegir voz: una libre, o la más vieja de prioridad <= ---
+    int elegida = -1;
+    int primera = PrimeraVoz[id];
+
+    for (int v = primera; v < primera + CantidadVoces[id]; v++)
+    {
+        if (!IsSoundPlaying(Voces[v].Sonido))
+        {
+            elegida = v;
+            break;
+        }
+
+        if (Voces[v].Prioridad <= prioridad &&
+            (elegida < 0 || Voces[v].Orden < Voces[elegida].Orden))
+            elegida = v;
+    }
+
+    if (elegida < 0) return;    // Todas ocupadas por sonidos más importantes
+
+    Voz& voz = Voces[elegida];
+    voz.Orden = ++ContadorDisparos;
+    voz.Prioridad = prioridad;
+    PlaySound(voz.Sonido);
+
+    DisparosSonido[id]++;
+    DisparosFrame++;
+}
+
+// ============================================================================
+// BUCLE DEL HILO DE AUDIO
+// ============================================================================
+// Alimenta el stream de música y ejecuta los disparos pendientes cada
+// pocos milisegundos, sin importar cuánto tarde el frame de dibujo.
+// ============================================================================
+static void BucleAudio()
+{
+    while (Activo.load(std::memory_order_acquire))
+    {
+        ComandoAudio cmd;
+        while (Desencolar(cmd))
+        {
+            if (cmd.Tipo == CMD_NUEVO_FRAME) ReiniciarPresupuesto();
+            else if (cmd.Tipo == CMD_REPRODUCIR) DispararVoz(cmd.Id, cmd.Prioridad);
+        }
+
+        if (HayMusica) UpdateMusicStream(Musica);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(4));
+    }
+}
+
+// ============================================================================
+// INTERFAZ PÚBLICA (hilo principal)
+// ============================================================================
+void Audio::Iniciar(const char* rutaMusica)
+{
+    int siguiente = 0;
+
+    for (int i = 0; i < SND_CANTIDAD; i++)
+    {
+        const ConfigSonido& cfg = Configuracion[i];
+
+        // Un solo decodificado por archivo; cada voz es una copia del Wave
+        Wave wave = LoadWave(cfg.Ruta);
+
+        PrimeraVoz[i] = siguiente;
+        CantidadVoces[i] = 0;
+
+        for (int v = 0; v < cfg.Voces && siguiente < MaxVoces; v++)
+        {
+            Voces[siguiente].Sonido = LoadSoundFromWave(wave);
+            if (Voces[siguiente].Sonido.frameCount > 0) Recursos::Anotar(REC_SONIDO, 1);
+            Voces[siguiente].Orden = 0;
+            Voces[siguiente].Prioridad = PRIORIDAD_BAJA;
+            siguiente++;
+            CantidadVoces[i]++;
+        }
+
+        UnloadWave(wave);
+    }
+
+    TraceLog(LOG_INFO, "AUDIO: %i voces precargadas", siguiente);
+
+    // Música de fondo en loop (desde acá solo la toca el hilo de audio)
+    if (rutaMusica)
+    {
+        Musica = LoadMusicStream(rutaMusica);
+        HayMusica = Musica.frameCount > 0;
+        if (HayMusica)
+        {
+            PlayMusicStream(Musica);
+            Recursos::Anotar(REC_SONIDO, 1);
+        }
+    }
+
+    Activo.store(true, std::memory_order_release);
+    HiloAudio = std::thread(BucleAudio);
+}
+
+void Audio::Liberar()
+{
+    // Primero se detiene el hilo: después nadie más toca las voces
+    Activo.store(false, std::memory_order_release);
+    if (HiloAudio.joinable()) HiloAudio.join();
+
+    if (Descartados.load() > 0)
+        TraceLog(LOG_WARNING, "AUDIO: %u comandos descartados por cola llena", Descartados.load());
+
+    if (HayMusica)
+    {
+        UnloadMusicStream(Musica);
+        Recursos::Anotar(REC_SONIDO, -1);
+    }
+    Musica = {};
+    HayMusica = false;
+
+    for (int i = 0; i < MaxVoces; i++)
+    {
+        if (Voces[i].Sonido.frameCount > 0)
+        {
+            UnloadSound(Voces[i].Sonido);
+            Recursos::Anotar(REC_SONIDO, -1);
+        }
+        Voces[i] = {};
+    }
+}
+
+void Audio::NuevoFrame()
+{
+    Encolar({ CMD_NUEVO_FRAME, SND_CANTIDAD, PRIORIDAD_BAJA });
+}
+
+void Audio::Reproducir(IdSonido id, PrioridadSonido prioridad)
+{
+    Encolar({ CMD_REPRODUCIR, id, prioridad });
+}
@@ -0,0 +1,46 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Recursos.hpp"
+
+// ============================================================================
+// PRIORIDAD DE UN SONIDO
+// ============================================================================
+// Cuando todas las voces de un sonido están ocupadas, solo se le roba la
+// voz más vieja a uno de prioridad igual o menor.
+// Los de prioridad ALTA además ignoran el presupuesto por frame.
+// ============================================================================
+enum PrioridadSonido : unsigned char
+{
+    PRIORIDAD_BAJA,         // Pasos y efectos repetitivos
+    PRIORIDAD_NORMAL,       // Saltos, golpes
+    PRIORIDAD_ALTA          // Interfaz, victoria y derrota
+};
+
+// ============================================================================
+// SISTEMA DE AUDIO (HILO PROPIO + POOL DE VOCES)
+// ============================================================================
+// La música y los efectos corren en un hilo dedicado: un frame largo ya no
+// deja sin datos al stream de música. El hilo principal solo encola
+// comandos en una cola sin locks; nunca llama a funciones de audio de raylib
+// después de Iniciar().
+//
+// Cada IdSonido tiene N voces precargadas (copias del mismo Wave), así un
+// paso nuevo no corta al anterior. Todas las voces se crean en Iniciar();
+// ni encolar ni reproducir reservan memoria.
+// ============================================================================
+namespace Audio
+{
+    // Carga los sonidos, crea sus voces, abre la música (puede ser nullptr)
+    // y arranca el hilo de audio. Requiere InitAudioDevice.
+    void Iniciar(const char* rutaMusica);
+
+    // Detiene el hilo y libera voces y música
+    void Liberar();
+
+    // Marca el comienzo de un frame: renueva el presupuesto de disparos
+    void NuevoFrame();
+
+    // Pide un sonido (se dispara en el hilo de audio, en una voz libre
+    // o en la más vieja que se pueda robar)
+    void Reproducir(IdSonido id, PrioridadSonido prioridad = PRIORIDAD_NORMAL);
+}
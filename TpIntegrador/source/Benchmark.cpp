@@ -0,0 +1,615 @@
+﻿#include "raylib.h"         // Solo CheckCollisionRecs, LoadImage y TraceLog: no se abre ventana
+#include "Recursos.hpp"     // Dimensiones de los sprites (sin GPU)
+#include "Arena.hpp"        // Memoria de los niveles sintéticos
+#include "Nivel.hpp"        // Plataformas, cajas y murciélagos
+#include "FisicaJugador.hpp"// Paso de física del jugador
+#include "Reglas.hpp"       // Condiciones de derrota
+#include "CapaTiles.hpp"    // Terreno en tiles (armado de mallas sin GPU)
+#include "Player.hpp"       // Jugador completo (física + animación) para los ticks
+#include "Puerta.hpp"
+#include "Simulacion.hpp"   // Tick determinista
+#include "Particulas.hpp"   // Pool de partículas (solo la integración)
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// MICRO-BENCHMARKS DE LOS CAMINOS CALIENTES DEL JUEGO
+// ============================================================================
+// Ejecutable sin ventana que mide, sobre niveles sintéticos de tamaño
+// creciente:
+//   - PasoFisicoJugador    (núcleo de Player::Update), ns por paso
+//   - EnemigoUpdate        ns por murciélago (movimiento + AABB)
+//   - EnemigoMixto         lo mismo con los cinco comportamientos repartidos
+//   - ParticulasUpdate     ns por partícula viva (integración + descarte),
+//                          con 50000 vivas (el tamaño es la cantidad)
+//   - PlataformaMovilUpdate ns por plataforma móvil (movimiento + AABB)
+//   - CheckCollisionRecs   ns por prueba rectángulo-rectángulo
+//   - GetRect              ns por recálculo de rectángulo desde la textura
+//   - AABBCacheado         ns por lectura del arreglo de colisionadores
+//   - ComprobarDerrota     ns por evaluación de las condiciones de derrota
+//   - ArmarMallaBloque     ns por tile al rearmar los vértices del terreno
+//   - Resimulacion         ns por tick completo (SimularTick); además informa
+//                          ticks por milisegundo y cuántos entran en un frame
+//
+// Antes de medir, comprueba que la simulación sea determinista: desde el
+// estado inicial del nivel y con la misma entrada, 600 ticks tienen que dar
+// la misma huella del estado completo (si no, termina con código 3).
+//
+// Uso:
+//   Benchmark [--salida archivo.json] [--base base.json] [--tolerancia 0.15]
+//             [--guardar-base base.json]
+//
+// Los resultados salen en JSON. Con --base se comparan contra una línea de
+// base y el proceso termina con código 1 si algún caso empeora más que la
+// tolerancia: así una regresión aparece como un número en la revisión.
+// ============================================================================
+
+struct ResultadoBench
+{
+    std::string Nombre;
+    int Tamanio;
+    double NsPorOp;
+};
+
+// Evita que el compilador descarte el trabajo medido
+static volatile float Sumidero = 0;
+
+// ============================================================================
+// GENERADOR DE NIVELES SINTÉTICOS
+// ============================================================================
+// Números pseudoaleatorios reproducibles (misma semilla = mismo nivel)
+static unsigned int SiguienteAleatorio(unsigned int& estado)
+{
+    estado = estado * 1664525u + 1013904223u;
+    return estado >> 8;
+}
+
+static float Aleatorio(unsigned int& estado, float min, float max)
+{
+    return min + (max - min) * (SiguienteAleatorio(estado) & 0xFFFF) / 65535.0f;
+}
+
+struct DisenoSintetico
+{
+    std::vector<Vector2> Plataformas;
+    std::vector<Vector2> Cajas;
+    std::vector<SpawnEnemigo> Enemigos;
+    std::vector<Vector2> UnaVia;
+    std::vector<SpawnPlataformaMovil> Moviles;
+    std::vector<unsigned char> Tiles;
+    std::vector<Vector2> PuntosRuta;
+    DisenoNivel Diseno;
+};
+
+// 'tamanio' plataformas, tamanio/8 cajas, 'tamanio' murciélagos y tamanio/8
+// plataformas de una vía y móviles repartidos en la pantalla, sobre un
+// terreno de 'tamanio' columnas (18 como mínimo) por FilasTerreno filas con
+// tramos de suelo, pinchos y huecos de largo al azar
+static void ArmarDisenoSintetico(int tamanio, unsigned int semilla, DisenoSintetico& d)
+{
+    int octavo = tamanio / 8 > 0 ? tamanio / 8 : 1;
+    d.Plataformas.resize(tamanio);
+    d.Cajas.resize(octavo);
+    d.Enemigos.resize(tamanio);
+    d.UnaVia.resize(octavo);
+    d.Moviles.resize(octavo);
+
+    for (auto& p : d.Plataformas)
+        p = { Aleatorio(semilla, 0, 900), Aleatorio(semilla, 150, 600) };
+
+    for (auto& c : d.Cajas)
+        c = { Aleatorio(semilla, 0, 950), Aleatorio(semilla, 150, 540) };
+
+    for (auto& e : d.Enemigos)
+    {
+        float x = Aleatorio(semilla, 100, 900);
+        e = { x, Aleatorio(semilla, 100, 550), x - 60, x + 60 };
+    }
+
+    for (auto& u : d.UnaVia)
+        u = { Aleatorio(semilla, 0, 900), Aleatorio(semilla, 150, 600) };
+
+    for (auto& m : d.Moviles)
+    {
+        float x = Aleatorio(semilla, 0, 800);
+        float y = Aleatorio(semilla, 150, 550);
+        m = { x, y, x + 100, y + Aleatorio(semilla, -50, 50), 60 };
+    }
+
+    const int FilasTerreno = 4;
+    int columnas = tamanio > 18 ? tamanio : 18;
+    d.Tiles.resize(columnas * FilasTerreno);
+    for (int f = 0; f < FilasTerreno; f++)
+        for (int c = 0; c < columnas;)
+        {
+            unsigned char id = (unsigned char)(SiguienteAleatorio(semilla) % TILE_CANTIDAD);
+            int largo = 1 + (int)(SiguienteAleatorio(semilla) % 8);
+            for (; largo > 0 && c < columnas; largo--, c++) d.Tiles[f * columnas + c] = id;
+        }
+
+    d.Diseno = {};
+    d.Diseno.Nombre = "Sintetico";
+    d.Diseno.Plataformas = d.Plataformas.data();
+    d.Diseno.NumPlataformas = (int)d.Plataformas.size();
+    d.Diseno.Cajas = d.Cajas.data();
+    d.Diseno.NumCajas = (int)d.Cajas.size();
+    d.Diseno.Enemigos = d.Enemigos.data();
+    d.Diseno.NumEnemigos = (int)d.Enemigos.size();
+    d.Diseno.PlataformasUnaVia = d.UnaVia.data();
+    d.Diseno.NumPlataformasUnaVia = (int)d.UnaVia.size();
+    d.Diseno.PlataformasMoviles = d.Moviles.data();
+    d.Diseno.NumPlataformasMoviles = (int)d.Moviles.size();
+    d.Diseno.Tiles = d.Tiles.data();
+    d.Diseno.ColumnasTiles = columnas;
+    d.Diseno.FilasTiles = FilasTerreno;
+}
+
+// Reparte los comportamientos entre los murciélagos del diseño, alternados
+// (el nivel los tiene que agrupar): el murciélago i vuela con el i % 5.
+// Cada ruta es un rombo de cuatro puntos alrededor de su posición.
+static void RepartirComportamientos(DisenoSintetico& d)
+{
+    d.PuntosRuta.clear();
+    for (size_t i = 0; i < d.Enemigos.size(); i++)
+    {
+        SpawnEnemigo& e = d.Enemigos[i];
+        e.Comportamiento = (ComportamientoEnemigo)(i % COMP_CANTIDAD);
+        e.MinY = e.Y - 60;
+        e.MaxY = e.Y + 60;
+        e.Amplitud = 30;
+        e.Frecuencia = 0.5f;
+        e.Radio = 150;
+
+        if (e.Comportamiento == COMP_RUTA)
+        {
+            e.PrimerPunto = (int)d.PuntosRuta.size();
+            e.NumPuntos = 4;
+            d.PuntosRuta.push_back({ e.X + 60, e.Y });
+            d.PuntosRuta.push_back({ e.X, e.Y + 60 });
+            d.PuntosRuta.push_back({ e.X - 60, e.Y });
+            d.PuntosRuta.push_back({ e.X, e.Y - 60 });
+        }
+    }
+
+    d.Diseno.PuntosRuta = d.PuntosRuta.data();
+    d.Diseno.NumPuntosRuta = (int)d.PuntosRuta.size();
+}
+
+// ============================================================================
+// MEDICIÓN
+// ============================================================================
+// Primero calibra cuántas llamadas entran en ~5 ms (así leer el reloj no
+// pesa en los casos chicos), después mide 15 tandas de ese tamaño y se
+// queda con la mejor (la menos afectada por ruido del sistema).
+template <typename F>
+static double Medir(F cuerpo, long long opsPorLlamada)
+{
+    using Reloj = std::chrono::steady_clock;
+    const std::chrono::milliseconds DuracionTanda(5);
+
+    cuerpo();   // Calentamiento (caché e instrucciones)
+
+    // --- Calibración ---
+    long long llamadas = 1;
+    for (;;)
+    {
+        Reloj::time_point inicio = Reloj::now();
+        for (long long i = 0; i < llamadas; i++) cuerpo();
+        if (Reloj::now() - inicio >= DuracionTanda) break;
+        llamadas *= 2;
+    }
+
+    // --- Medición ---
+    double mejor = 1e300;
+    for (int rep = 0; rep < 15; rep++)
+    {
+        Reloj::time_point inicio = Reloj::now();
+        for (long long i = 0; i < llamadas; i++) cuerpo();
+        Reloj::duration transcurrido = Reloj::now() - inicio;
+
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(transcurrido).count();
+        double nsPorOp = ns / (double)(llamadas * opsPorLlamada);
+        if (nsPorOp < mejor) mejor = nsPorOp;
+    }
+
+    return mejor;
+}
+
+// ============================================================================
+// DETERMINISMO
+// ============================================================================
+// Recorrido fijo: va y vuelve saltando cada 40 ticks y hace click a mitad
+static void ArmarEntradasGuion(int cantidad, std::vector<EntradaFrame>& entradas)
+{
+    entradas.resize(cantidad);
+    for (int i = 0; i < cantidad; i++)
+    {
+        EntradaFrame& e = entradas[i];
+        e = {};
+        e.Dt = DtTick;
+        e.Botones = (i / 120) % 2 == 0 ? ENT_DERECHA : ENT_IZQUIERDA;
+        if (i % 40 == 0) e.Botones |= ENT_SALTO;
+        if (i == cantidad / 2) e.Botones |= ENT_CLICK;
+        e.Mouse = { 350, 250 };
+    }
+}
+
+// Huella del estado que cambia al jugar (FNV-1a de 64 bits), campo por
+// campo: el relleno de los structs no entra. A diferencia de una
+// instantánea no tiene capacidad, así que cubre niveles de cualquier tamaño.
+static void Mezclar(unsigned long long& h, const void* datos, size_t bytes)
+{
+    const unsigned char* p = (const unsigned char*)datos;
+    for (size_t i = 0; i < bytes; i++) h = (h ^ p[i]) * 1099511628211ull;
+}
+
+template <typename T>
+static void Mezclar(unsigned long long& h, const T& valor)
+{
+    Mezclar(h, &valor, sizeof(T));
+}
+
+static unsigned long long HuellaEstado(const Nivel& nivel, const Player& jugador,
+                                       const Puerta& puerta, float tiempo)
+{
+    unsigned long long h = 14695981039346656037ull;
+    Mezclar(h, tiempo);
+
+    const EstadoJugador& f = jugador.Fisica;
+    Mezclar(h, f.Posicion);
+    Mezclar(h, f.Velocidad);
+    Mezclar(h, f.BufferSalto);
+    Mezclar(h, f.ContadorSaltos);
+    Mezclar(h, f.EnSuelo);
+    Mezclar(h, f.TipoActual);
+    Mezclar(h, f.MirandoDerecha);
+    Mezclar(h, f.Moviendo);
+    Mezclar(h, f.Apoyo);
+    Mezclar(h, jugador.Animacion.Clip);
+    Mezclar(h, jugador.Animacion.Tiempo);
+    Mezclar(h, jugador.TimerPaso);
+
+    Mezclar(h, puerta.EstaAbierta);
+    Mezclar(h, puerta.MostrarDialogo);
+
+    for (int i = 0; i < nivel.NumEnemigos; i++)
+    {
+        const Enemigo& e = nivel.Enemigos[i];
+        Mezclar(h, e.Posicion);
+        Mezclar(h, e.Velocidad);
+        Mezclar(h, e.Animacion.Clip);
+        Mezclar(h, e.Animacion.Tiempo);
+        Mezclar(h, e.Fase);
+        Mezclar(h, e.Picada);
+        Mezclar(h, e.Destino);
+        Mezclar(h, e.PuntoActual);
+        Mezclar(h, nivel.RectEnemigos[i]);
+    }
+
+    for (int i = 0; i < nivel.NumPlataformasMoviles; i++)
+    {
+        const PlataformaMovil& m = nivel.PlataformasMoviles[i];
+        Mezclar(h, m.Base.Posicion);
+        Mezclar(h, m.Recorrido);
+        Mezclar(h, m.Sentido);
+        Mezclar(h, m.Desplazamiento);
+        Mezclar(h, nivel.RectMoviles[i]);
+    }
+
+    return h;
+}
+
+// Corre el guion desde el estado inicial del nivel y devuelve la huella final
+static unsigned long long CorrerGuion(Nivel& nivel, const std::vector<EntradaFrame>& entradas)
+{
+    ReiniciarNivel(nivel);
+    Player jugador;
+    Puerta puerta;
+    float tiempo = 0;
+
+    // Sin cortar en la derrota: se simulan todos los ticks
+    for (const EntradaFrame& entrada : entradas) SimularTick(nivel, jugador, puerta, tiempo, entrada);
+    return HuellaEstado(nivel, jugador, puerta, tiempo);
+}
+
+// Corre el guion dos veces desde el estado inicial y compara las huellas
+static bool ComprobarDeterminismo(Nivel& nivel)
+{
+    const int Ticks = 600;
+    std::vector<EntradaFrame> entradas;
+    ArmarEntradasGuion(Ticks, entradas);
+
+    unsigned long long primera = CorrerGuion(nivel, entradas);
+    unsigned long long segunda = CorrerGuion(nivel, entradas);
+
+    ReiniciarNivel(nivel);
+    return primera == segunda;
+}
+
+// ============================================================================
+// CASOS
+// ============================================================================
+static void CorrerCasos(Nivel& nivel, int tamanio, std::vector<ResultadoBench>& resultados)
+{
+    const int PasosPorLlamada = 600;    // 10 segundos de juego a 60 FPS
+    const float dt = 1.0f / 60.0f;
+
+    // --- PasoFisicoJugador ---
+    EstadoJugador jugador;
+    double nsPaso = Medir([&]() {
+        IniciarEstadoJugador(jugador, Recursos::AnchoCuadro(TEX_CABALLERO) * 0.15f, Recursos::AltoCuadro(TEX_CABALLERO) * 0.15f);
+        for (int i = 0; i < PasosPorLlamada; i++)
+        {
+            // Recorrido fijo: va y vuelve saltando cada 40 pasos
+            EntradaJugador entrada;
+            entrada.Derecha = (i / 120) % 2 == 0;
+            entrada.Izquierda = !entrada.Derecha;
+            entrada.Salto = i % 40 == 0;
+            PasoFisicoJugador(jugador, entrada, dt, nivel);
+        }
+        Sumidero = Sumidero + jugador.Posicion.x;
+    }, PasosPorLlamada);
+    resultados.push_back({ "PasoFisicoJugador", tamanio, nsPaso });
+
+    // --- EnemigoUpdate ---
+    Vector2 centroJugador = { 400, 300 };
+    double nsEnemigo = Medir([&]() {
+        ActualizarEnemigos(nivel, dt, centroJugador);
+        Sumidero = Sumidero + nivel.Enemigos[0].Posicion.x;
+    }, nivel.NumEnemigos);
+    resultados.push_back({ "EnemigoUpdate", tamanio, nsEnemigo });
+
+    // --- PlataformaMovilUpdate (movimiento + desplazamiento publicado en el Mundo) ---
+    double nsMovil = Medir([&]() {
+        ActualizarPlataformasMoviles(nivel, dt);
+        Sumidero = Sumidero + nivel.PlataformasMoviles[0].Base.Posicion.x;
+    }, nivel.NumPlataformasMoviles);
+    resultados.push_back({ "PlataformaMovilUpdate", tamanio, nsMovil });
+
+    // --- CheckCollisionRecs (jugador contra todas las plataformas) ---
+    Rectangle rectJugador = { 400, 300, 40, 72 };
+
+    double nsColision = Medir([&]() {
+        int choques = 0;
+        for (int i = 0; i < nivel.NumPlataformas; i++)
+            if (CheckCollisionRecs(rectJugador, nivel.RectPlataformas[i])) choques++;
+        Sumidero = Sumidero + (float)choques;
+    }, nivel.NumPlataformas);
+    resultados.push_back({ "CheckCollisionRecs", tamanio, nsColision });
+
+    // --- GetRect (plataformas + cajas + murciélagos) ---
+    long long totalRects = nivel.NumPlataformas + nivel.NumCajas + nivel.NumEnemigos;
+    double nsGetRect = Medir([&]() {
+        float suma = 0;
+        for (int i = 0; i < nivel.NumPlataformas; i++) suma += nivel.Plataformas[i].GetRect().width;
+        for (int i = 0; i < nivel.NumCajas; i++) suma += nivel.Cajas[i].GetRect().width;
+        for (int i = 0; i < nivel.NumEnemigos; i++) suma += nivel.Enemigos[i].GetRect().width;
+        Sumidero = Sumidero + suma;
+    }, totalRects);
+    resultados.push_back({ "GetRect", tamanio, nsGetRect });
+
+    // --- AABBCacheado (lo mismo, leyendo el arreglo empaquetado del Mundo) ---
+    double nsCacheado = Medir([&]() {
+        float suma = 0;
+        for (int i = 0; i < nivel.Mundo.Num; i++) suma += nivel.Mundo.Rects[i].width;
+        Sumidero = Sumidero + suma;
+    }, nivel.Mundo.Num);
+    resultados.push_back({ "AABBCacheado", tamanio, nsCacheado });
+
+    // --- ComprobarDerrota (jugador vivo: recorre todos los murciélagos) ---
+    EstadoJugador vivo;
+    IniciarEstadoJugador(vivo, Recursos::AnchoCuadro(TEX_CABALLERO) * 0.15f, Recursos::AltoCuadro(TEX_CABALLERO) * 0.15f);
+    vivo.Posicion = { -500, -500 };     // Fuera de todo: peor caso, ningún chequeo corta antes
+    double nsDerrota = Medir([&]() {
+        Sumidero = Sumidero + (float)ComprobarDerrota(vivo, nivel, 1.0f);
+    }, 1);
+    resultados.push_back({ "ComprobarDerrota", tamanio, nsDerrota });
+
+    // --- ArmarMallaBloque (todos los bloques y tipos, como al cargar el nivel) ---
+    const CapaTiles& capa = nivel.Terreno;
+    const int TilesBloque = ColumnasBloque * FilasBloque;
+    std::vector<float> vertices(TilesBloque * 12), uv(TilesBloque * 8);
+    std::vector<unsigned short> indices(TilesBloque * 6);
+    double nsMalla = Medir([&]() {
+        int tiles = 0;
+        for (int b = 0; b < capa.ColumnasBloques * capa.FilasBloques; b++)
+            for (int t = TILE_VACIO + 1; t < TILE_CANTIDAD; t++)
+                tiles += ArmarVerticesBloque(capa, b, (IdTile)t, vertices.data(), uv.data(), indices.data());
+        Sumidero = Sumidero + (float)tiles + vertices[0];
+    }, capa.Columnas * capa.Filas);
+    resultados.push_back({ "ArmarMallaBloque", tamanio, nsMalla });
+
+    // --- Resimulacion (ticks completos, como al rebobinar o correr un fantasma) ---
+    std::vector<EntradaFrame> entradas;
+    ArmarEntradasGuion(PasosPorLlamada, entradas);
+
+    Player jugadorSim;
+    Puerta puertaSim;
+    float tiempoSim = 0;
+    double nsTick = Medir([&]() {
+        jugadorSim.Reiniciar();
+        for (int i = 0; i < PasosPorLlamada; i++)
+            SimularTick(nivel, jugadorSim, puertaSim, tiempoSim, entradas[i]);
+        Sumidero = Sumidero + jugadorSim.Fisica.Posicion.x;
+    }, PasosPorLlamada);
+    resultados.push_back({ "Resimulacion", tamanio, nsTick });
+
+    std::fprintf(stderr, "Resimulacion %6d: %.0f ticks/ms, %.0f ticks por frame de 16.6 ms\n",
+        tamanio, 1e6 / nsTick, 16.6e6 / nsTick);
+}
+
+
+// ============================================================================
+// ENTRADA / SALIDA JSON
+// ============================================================================
+static bool EscribirJson(const char* ruta, const std::vector<ResultadoBench>& resultados)
+{
+    FILE* f = ruta ? std::fopen(ruta, "w") : stdout;
+    if (!f) return false;
+
+    std::fprintf(f, "{\n  \"resultados\": [\n");
+    for (size_t i = 0; i < resultados.size(); i++)
+    {
+        const ResultadoBench& r = resultados[i];
+        std::fprintf(f, "    { \"nombre\": \"%s\", \"tamanio\": %d, \"ns_por_op\": %.3f }%s\n",
+            r.Nombre.c_str(), r.Tamanio, r.NsPorOp, i + 1 < resultados.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+
+    if (ruta) std::fclose(f);
+    return true;
+}
+
+// Lee un archivo escrito por EscribirJson (un resultado por línea)
+static bool LeerJson(const char* ruta, std::vector<ResultadoBench>& resultados)
+{
+    FILE* f = std::fopen(ruta, "r");
+    if (!f) return false;
+
+    char linea[512];
+    while (std::fgets(linea, sizeof(linea), f))
+    {
+        char nombre[64];
+        int tamanio;
+        double ns;
+        if (std::sscanf(linea, " { \"nombre\": \"%63[^\"]\", \"tamanio\": %d, \"ns_por_op\": %lf",
+            nombre, &tamanio, &ns) == 3)
+            resultados.push_back({ nombre, tamanio, ns });
+    }
+
+    std::fclose(f);
+    return true;
+}
+
+// Devuelve la cantidad de casos que empeoraron más que la tolerancia
+static int CompararConBase(const std::vector<ResultadoBench>& actuales,
+    const std::vector<ResultadoBench>& base, double tolerancia)
+{
+    int regresiones = 0;
+
+    for (const ResultadoBench& a : actuales)
+    {
+        for (const ResultadoBench& b : base)
+        {
+            if (a.Nombre != b.Nombre || a.Tamanio != b.Tamanio) continue;
+
+            double cambio = (a.NsPorOp - b.NsPorOp) / b.NsPorOp;
+            bool empeoro = cambio > tolerancia;
+            if (empeoro) regresiones++;
+
+            std::fprintf(stderr, "%-20s %6d  base %10.3f ns  actual %10.3f ns  %+6.1f%%%s\n",
+                a.Nombre.c_str(), a.Tamanio, b.NsPorOp, a.NsPorOp, cambio * 100.0,
+                empeoro ? "  <-- REGRESION" : "");
+        }
+    }
+
+    return regresiones;
+}
+
+// ============================================================================
+// PROGRAMA PRINCIPAL
+// ============================================================================
+int main(int argc, char** argv)
+{
+    const char* rutaSalida = nullptr;
+    const char* rutaBase = nullptr;
+    const char* rutaGuardarBase = nullptr;
+    double tolerancia = 0.15;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "--salida") && i + 1 < argc) rutaSalida = argv[++i];
+        else if (!std::strcmp(argv[i], "--base") && i + 1 < argc) rutaBase = argv[++i];
+        else if (!std::strcmp(argv[i], "--guardar-base") && i + 1 < argc) rutaGuardarBase = argv[++i];
+        else if (!std::strcmp(argv[i], "--tolerancia") && i + 1 < argc) tolerancia = std::atof(argv[++i]);
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Solo dimensiones de los sprites: no hay ventana ni GPU
+    Recursos::CargarSinVentana();
+
+    // Niveles sintéticos de tamaño creciente (misma semilla = mismos números)
+    static const int Tamanios[] = { 16, 256, 4096 };
+    std::vector<ResultadoBench> resultados;
+
+    ArenaNivel arena(8 * 1024 * 1024);
+
+    for (int tamanio : Tamanios)
+    {
+        DisenoSintetico d;
+        ArmarDisenoSintetico(tamanio, 12345u + tamanio, d);
+
+        Nivel nivel;
+        if (!ConstruirNivel(100 + tamanio, d.Diseno, arena, nivel))
+            return 2;
+
+        if (!ComprobarDeterminismo(nivel))
+        {
+            std::fprintf(stderr, "La simulacion no es determinista (nivel de %d)\n", tamanio);
+            return 3;
+        }
+
+        CorrerCasos(nivel, tamanio, resultados);
+        DescargarNivel(nivel, arena);
+
+        // --- EnemigoMixto (mismo nivel, todos los comportamientos) ---
+        RepartirComportamientos(d);
+        if (!ConstruirNivel(100 + tamanio, d.Diseno, arena, nivel))
+            return 2;
+
+        if (!ComprobarDeterminismo(nivel))
+        {
+            std::fprintf(stderr, "La simulacion no es determinista (nivel mixto de %d)\n", tamanio);
+            return 3;
+        }
+
+        Vector2 centroJugador = { 400, 300 };
+        double nsMixto = Medir([&]() {
+            ActualizarEnemigos(nivel, 1.0f / 60.0f, centroJugador);
+            Sumidero = Sumidero + nivel.Enemigos[0].Posicion.x;
+        }, nivel.NumEnemigos);
+        resultados.push_back({ "EnemigoMixto", tamanio, nsMixto });
+
+        DescargarNivel(nivel, arena);
+    }
+
+    // --- ParticulasUpdate (vida larga: las 50000 siguen vivas en cada medición) ---
+    const int NumParticulas = 50000;
+    const EstiloRafaga Rafaga = { WHITE, GRAY, 40, 120, -3.0f, -0.14f, 1e6f, 1e6f, 2, 4, 320, 3 };
+    Particulas::Vaciar();
+    Particulas::Emitir(Rafaga, { 512, 400 }, NumParticulas);
+    double nsParticula = Medir([&]() {
+        Particulas::Actualizar(1.0f / 60.0f);
+        Sumidero = Sumidero + (float)Particulas::Vivas();
+    }, NumParticulas);
+    resultados.push_back({ "ParticulasUpdate", NumParticulas, nsParticula });
+    Particulas::Vaciar();
+
+    EscribirJson(rutaSalida, resultados);
+
+    if (rutaGuardarBase && !EscribirJson(rutaGuardarBase, resultados))
+    {
+        std::fprintf(stderr, "No se pudo escribir %s\n", rutaGuardarBase);
+        return 2;
+    }
+
+    int regresiones = 0;
+    if (rutaBase)
+    {
+        std::vector<ResultadoBench> base;
+        if (!LeerJson(rutaBase, base))
+        {
+            std::fprintf(stderr, "No se pudo leer la base %s\n", rutaBase);
+            return 2;
+        }
+        regresiones = CompararConBase(resultados, base, tolerancia);
+    }
+
+    Recursos::Liberar();
+    return regresiones > 0 ? 1 : 0;
+}
@@ -0,0 +1,211 @@
+﻿#include "Bot.hpp"
+#include "Simulacion.hpp"
+#include <cmath>
+
+// ============================================================================
+// RUTA GANADORA (la misma que GuionVictoria del arnés de regresión)
+// ============================================================================
+// Con el tick fijo la partida es determinista: empezando en el primer frame
+// de JUGANDO, esta entrada llega siempre a la puerta. El pulso va solo en
+// el primer frame del tramo.
+// ============================================================================
+struct TramoRuta
+{
+    short Frames;
+    unsigned short Mantenidos;
+    unsigned short Pulso;
+};
+
+static const unsigned short Der = ENT_DERECHA;
+static const unsigned short Izq = ENT_IZQUIERDA;
+
+static const TramoRuta Ruta[] = {
+    { 21, Der, 0 }, { 1, Der, ENT_SALTO }, { 72, Der, 0 },                     // Suelo → plataforma 1
+    { 1, Der, ENT_SALTO }, { 48, Der, 0 },                                      // → plataforma 2
+    { 1, Der, ENT_SALTO }, { 25, Der, 0 }, { 36, 0, 0 },                        // Por encima del murciélago
+    { 13, Der, 0 }, { 1, Der, ENT_SALTO }, { 50, Der, 0 },                      // → plataforma 3
+    { 1, Der, ENT_SALTO }, { 46, Der, 0 }, { 17, 0, 0 },                        // → caja
+    { 116, 0, 0 }, { 13, Izq, 0 },                                              // Espera al murciélago de arriba
+    { 1, Izq, ENT_SALTO }, { 36, Izq, 0 }, { 9, 0, 0 },                         // → plataforma 4
+    { 24, Izq, 0 }, { 1, Izq, ENT_SALTO }, { 74, Izq, 0 }, { 27, 0, 0 }         // → plataforma 5 (puerta)
+};
+
+static const int NumTramos = (int)(sizeof(Ruta) / sizeof(Ruta[0]));
+
+// Píxeles por frame que avanza el cursor
+static const float PasoCursor = 24.0f;
+
+// ============================================================================
+// AZAR PROPIO (misma semilla, misma corrida)
+// ============================================================================
+static unsigned int Azar(Bot& bot)
+{
+    bot.Semilla = bot.Semilla * 1664525u + 1013904223u;
+    return bot.Semilla >> 8;
+}
+
+static int EntreBot(Bot& bot, int minimo, int maximo)
+{
+    return minimo + (int)(Azar(bot) % (unsigned int)(maximo - minimo + 1));
+}
+
+// ============================================================================
+// AUXILIARES
+// ============================================================================
+static Vector2 Centro(Rectangle r)
+{
+    return { r.x + r.width / 2, r.y + r.height / 2 };
+}
+
+// Acerca el cursor a Destino. true si ya llegó.
+static bool MoverCursor(Bot& bot)
+{
+    float dx = bot.Destino.x - bot.Mouse.x;
+    float dy = bot.Destino.y - bot.Mouse.y;
+    float d = std::sqrt(dx * dx + dy * dy);
+
+    if (d <= PasoCursor)
+    {
+        bot.Mouse = bot.Destino;
+        return true;
+    }
+
+    bot.Mouse.x += dx / d * PasoCursor;
+    bot.Mouse.y += dy / d * PasoCursor;
+    return false;
+}
+
+static void EmpezarPartida(Bot& bot)
+{
+    bot.Partidas++;
+
+    int r = EntreBot(bot, 0, 9);
+    bot.Modo = r < 5 ? BOT_RUTA : r < 8 ? BOT_AL_AZAR : BOT_REINICIOS;
+    bot.Tramo = 0;
+    bot.FramesTramo = bot.Modo == BOT_RUTA ? Ruta[0].Frames : 0;
+    bot.Mantenidos = 0;
+    bot.FramesHastaReinicio = EntreBot(bot, 60, 600);
+}
+
+// ============================================================================
+// JUGANDO
+// ============================================================================
+static unsigned short JugarRuta(Bot& bot, const Juego& juego)
+{
+    if (bot.Tramo < NumTramos)
+    {
+        const TramoRuta& t = Ruta[bot.Tramo];
+        unsigned short botones = t.Mantenidos;
+        if (bot.FramesTramo == t.Frames) botones |= t.Pulso;
+
+        if (--bot.FramesTramo == 0 && ++bot.Tramo < NumTramos)
+            bot.FramesTramo = Ruta[bot.Tramo].Frames;
+        return botones;
+    }
+
+    // Llegó a la puerta: cursor encima y click. Si la ruta se desvió y no
+    // ganó, sigue al azar hasta que la partida termine.
+    bot.Destino = Centro(juego.LaPuerta.GetRect());
+    if (!MoverCursor(bot)) return 0;
+
+    bot.Modo = BOT_AL_AZAR;
+    return ENT_CLICK;
+}
+
+static unsigned short JugarAlAzar(Bot& bot, const Juego& juego)
+{
+    if (bot.Modo == BOT_REINICIOS && --bot.FramesHastaReinicio <= 0)
+    {
+        bot.Reinicios++;
+        EmpezarPartida(bot);
+        return ENT_REINICIAR;
+    }
+
+    unsigned short pulso = 0;
+    if (bot.FramesTramo <= 0)
+    {
+        // Tramo nuevo: caminar, quedarse o rebobinar; a veces con un salto
+        int r = EntreBot(bot, 0, 9);
+        bot.Mantenidos = r < 4 ? Der : r < 7 ? Izq : r < 9 ? 0 : ENT_REBOBINAR;
+        bot.FramesTramo = EntreBot(bot, 10, 60);
+        if (EntreBot(bot, 0, 3) == 0) pulso |= ENT_SALTO;
+
+        // De vez en cuando intenta la puerta desde donde esté
+        if (EntreBot(bot, 0, 7) == 0)
+        {
+            bot.Destino = Centro(juego.LaPuerta.GetRect());
+            pulso |= ENT_CLICK;
+        }
+    }
+
+    bot.FramesTramo--;
+    MoverCursor(bot);
+    return (unsigned short)(bot.Mantenidos | pulso);
+}
+
+// ============================================================================
+// INTERFAZ PÚBLICA
+// ============================================================================
+void IniciarBot(Bot& bot, unsigned int semilla)
+{
+    bot = {};
+    bot.Semilla = semilla;
+    bot.EstadoVisto = MENU;
+    bot.Espera = 30;
+    bot.Mouse = bot.Destino = { 512, 300 };
+}
+
+EntradaFrame SiguienteEntradaBot(Bot& bot, const Juego& juego)
+{
+    // Cambio de pantalla: una pausa de "persona" antes de actuar
+    if (juego.Estado != bot.EstadoVisto)
+    {
+        bot.EstadoVisto = juego.Estado;
+        bot.Espera = EntreBot(bot, 20, 90);
+
+        if (juego.Estado == JUGANDO) EmpezarPartida(bot);
+        else if (juego.Estado == TRANSICION_GANASTE) bot.Victorias++;
+        else if (juego.Estado == TRANSICION_PERDISTE) bot.Derrotas++;
+        else if (juego.Estado == PERDISTE) bot.AlMenu = EntreBot(bot, 0, 2) == 0;
+    }
+
+    unsigned short botones = 0;
+
+    switch (juego.Estado)
+    {
+    case MENU:
+        bot.Destino = Centro(juego.RectPlay);
+        if (bot.Espera > 0)
+        {
+            // Mientras espera, a veces muestra y oculta los controles (M)
+            if (bot.Espera == 10 && EntreBot(bot, 0, 7) == 0) botones |= ENT_CONTROLES;
+            bot.Espera--;
+            MoverCursor(bot);
+        }
+        else if (MoverCursor(bot)) botones |= ENT_CLICK;
+        break;
+
+    case JUGANDO:
+        botones = bot.Modo == BOT_RUTA ? JugarRuta(bot, juego) : JugarAlAzar(bot, juego);
+        break;
+
+    case GANASTE:
+        if (--bot.Espera <= 0) botones |= ENT_REINICIAR;
+        break;
+
+    case PERDISTE:
+    {
+        // Los botones se miden al componer la pantalla (el primer frame)
+        Vector2 boton = bot.AlMenu ? juego.PosMenu : juego.PosRetry;
+        bot.Destino = { boton.x + 125, boton.y + 17 };
+        bool llego = MoverCursor(bot);
+        if (--bot.Espera <= 0 && llego) botones |= ENT_CLICK;
+        break;
+    }
+
+    default:    // Transiciones: no responden a la entrada
+        break;
+    }
+
+    return { DtTick, bot.Mouse, botones, 0 };
+}
@@ -0,0 +1,57 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Entrada.hpp"
+#include "Juego.hpp"
+
+// ============================================================================
+// BOT DE PRUEBAS DE RESISTENCIA
+// ============================================================================
+// Juega el juego real a través de la misma EntradaFrame que arma el teclado:
+// mira el estado público del Juego (pantalla, botones, puerta) y devuelve
+// la entrada del próximo frame. Nunca toca EXIT, así que puede seguir
+// horas sin nadie enfrente.
+//
+// En cada partida elige (con su propia semilla, para poder repetir una
+// corrida) una de tres formas de jugar:
+//   BOT_RUTA       la ruta ganadora del arnés de regresión y click en la puerta
+//   BOT_AL_AZAR    tramos al azar de caminar y saltar (termina perdiendo)
+//   BOT_REINICIOS  como al azar, pero aprieta R cada pocos segundos
+// En PERDISTE elige REINTENTAR o MENU; en GANASTE vuelve a jugar con R.
+// ============================================================================
+enum ModoBot
+{
+    BOT_RUTA,
+    BOT_AL_AZAR,
+    BOT_REINICIOS
+};
+
+struct Bot
+{
+    unsigned int Semilla;
+
+    EstadoJuego EstadoVisto;    // Pantalla del frame anterior (para ver los cambios)
+    int Espera;                 // Frames hasta la próxima acción en la pantalla actual
+
+    // Partida en curso
+    ModoBot Modo;
+    int Tramo;                  // Ruta: tramo actual
+    int FramesTramo;            // Frames que le quedan al tramo (ruta o al azar)
+    unsigned short Mantenidos;  // Teclas del tramo al azar
+    int FramesHastaReinicio;
+    bool AlMenu;                // En PERDISTE: MENU en lugar de REINTENTAR
+
+    // Cursor: se desliza hacia Destino unos píxeles por frame
+    Vector2 Mouse;
+    Vector2 Destino;
+
+    // Lo que lleva jugado (para el informe)
+    int Partidas;
+    int Victorias;
+    int Derrotas;
+    int Reinicios;
+};
+
+void IniciarBot(Bot& bot, unsigned int semilla);
+
+// Entrada del próximo frame (Dt = DtTick) según lo que muestra 'juego'
+EntradaFrame SiguienteEntradaBot(Bot& bot, const Juego& juego);
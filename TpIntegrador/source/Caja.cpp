@@ -1,27 +1,21 @@
 #include "Caja.hpp"
 
-// CONSTRUCTOR: carga textura y fija posicin
+// CONSTRUCTOR: carga textura y fija posición
 Caja::Caja(float x, float y)
 {
-	Textura = LoadTexture("Caja.png");	// Carga la textura de la caja
-	Escala = 1.0f;						// Tamao sin cambios
-	Posicion = { x, y };				// Ubicacin inicial en pantalla
+	Textura = TEX_CAJA;					// Textura compartida de la caja
+	Escala = 1.0f;						// Tamaño sin cambios
+	Posicion = { x, y };				// Ubicación inicial en pantalla
 }
 
-// RECTNGULO DE COLISIN
+// RECTÁNGULO DE COLISIÓN
 Rectangle Caja::GetRect() const
 {
-	return { Posicion.x, Posicion.y, Textura.width * Escala, Textura.height * Escala };
+	return { Posicion.x, Posicion.y, Recursos::Ancho(Textura) * Escala, Recursos::Alto(Textura) * Escala };
 }
 
 // DIBUJADO EN PANTALLA
 void Caja::Draw() const
 {
-	DrawTextureEx(Textura, Posicion, 0, Escala, WHITE);
-}
-
-// DESTRUCTOR: libera la textura de la caja
-Caja::~Caja()
-{
-	UnloadTexture(Textura);
+	DrawTextureEx(Recursos::Textura(Textura), Posicion, 0, Escala, WHITE);
 }
\ No newline at end of file
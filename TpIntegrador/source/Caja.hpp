@@ -1,28 +1,27 @@
 #pragma once
 #include "raylib.h"
+#include "Recursos.hpp"
 
 // ============================================================================
 // CLASE CAJA
 // ============================================================================
-// Representa una caja esttica del escenario.
+// Representa una caja estática del escenario.
 // El jugador puede pararse encima y colisiona igual que con una plataforma.
+// Es un dato plano: la textura la guarda el gestor de Recursos.
 // ============================================================================
 class Caja
 {
 public:
-	Vector2 Posicion;		// Posicin en pantalla
-	Texture2D Textura;		// Imagen de la caja
+	Vector2 Posicion;		// Posición en pantalla
+	IdTextura Textura;		// Imagen de la caja (identificador en Recursos)
 	float Escala;			// Factor de escala visual
 
-	// Constructor: inicializa posicin, textura y escala
+	// Constructor: inicializa posición, textura y escala (sin cargar nada)
 	Caja(float x, float y);
 
-	// Devuelve el rectngulo de colisin de la caja
+	// Calcula el rectángulo de colisión de la caja (el Nivel lo guarda en RectCajas)
 	Rectangle GetRect() const;
 
 	// Dibuja la caja en pantalla
 	void Draw() const;
-
-	// Liberacin de recursos
-	~Caja();
 };
\ No newline at end of file
@@ -0,0 +1,275 @@
+﻿#include "CapaTiles.hpp"
+#include "FisicaJugador.hpp"
+#include "Reglas.hpp"
+#include "Instanciado.hpp"      // Vaciado y conteo de llamadas de dibujo
+#include "raylib.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <cmath>
+
+// ============================================================================
+// TABLA DE TIPOS (en el mismo orden que IdTile)
+// ============================================================================
+// El suelo se pisa desde arriba; los pinchos (17 px más altos que la fila)
+// hacen perder al tocarlos.
+static const TipoTile Tipos[TILE_CANTIDAD] = {
+    { TEX_SUELO,    0.0f,  0,           0 },                  // TILE_VACIO
+    { TEX_SUELO,    0.0f,  COL_UNA_VIA, SUELO_PASTO },        // TILE_SUELO
+    { TEX_PINCHOS,  17.0f, COL_PELIGRO, PERDIDA_PINCHOS }     // TILE_PINCHOS
+};
+
+const TipoTile& ObtenerTipoTile(IdTile id)
+{
+    return Tipos[id];
+}
+
+// ============================================================================
+// GRILLA
+// ============================================================================
+bool IniciarCapa(CapaTiles& capa, ArenaNivel& arena, const unsigned char* ids,
+                 int columnas, int filas, Vector2 origen)
+{
+    capa = {};
+    capa.Columnas = columnas;
+    capa.Filas = filas;
+    capa.Origen = origen;
+
+    int celdas = columnas * filas;
+    if (celdas <= 0) return true;       // Nivel sin terreno: válido
+
+    capa.ColumnasBloques = (columnas + ColumnasBloque - 1) / ColumnasBloque;
+    capa.FilasBloques = (filas + FilasBloque - 1) / FilasBloque;
+
+    capa.Ids = arena.ReservarArreglo<unsigned char>(celdas);
+    capa.Bloques = arena.ReservarArreglo<BloqueTiles>(capa.ColumnasBloques * capa.FilasBloques);
+    if (!capa.Ids || !capa.Bloques) return false;
+
+    for (int i = 0; i < celdas; i++) capa.Ids[i] = ids[i];
+    for (int b = 0; b < capa.ColumnasBloques * capa.FilasBloques; b++) capa.Bloques[b].Sucio = true;
+    return true;
+}
+
+void LiberarCapa(CapaTiles& capa)
+{
+    for (int b = 0; b < capa.ColumnasBloques * capa.FilasBloques; b++)
+    {
+        BloqueTiles& bloque = capa.Bloques[b];
+        for (int t = TILE_VACIO + 1; t < TILE_CANTIDAD; t++)
+        {
+            if (bloque.Mallas[t].vertexCount > 0)
+            {
+                UnloadMesh(bloque.Mallas[t]);
+                Recursos::Anotar(REC_MALLA, -1);
+            }
+            bloque.Mallas[t] = {};
+        }
+        bloque.Sucio = true;
+    }
+}
+
+IdTile TileEn(const CapaTiles& capa, int columna, int fila)
+{
+    if (columna < 0 || columna >= capa.Columnas || fila < 0 || fila >= capa.Filas)
+        return TILE_VACIO;
+    return (IdTile)capa.Ids[fila * capa.Columnas + columna];
+}
+
+void CambiarTile(CapaTiles& capa, int columna, int fila, IdTile id)
+{
+    if (columna < 0 || columna >= capa.Columnas || fila < 0 || fila >= capa.Filas)
+        return;
+
+    unsigned char& celda = capa.Ids[fila * capa.Columnas + columna];
+    if (celda == id) return;
+
+    celda = id;
+    capa.Bloques[(fila / FilasBloque) * capa.ColumnasBloques + columna / ColumnasBloque].Sucio = true;
+}
+
+// ============================================================================
+// COLISIÓN (tramos de tiles iguales por fila)
+// ============================================================================
+// Recorre los tramos y llama a 'cargar' con la fila, la primera columna,
+// el largo y el tipo de cada uno
+template <typename F>
+static int RecorrerTramos(const CapaTiles& capa, F cargar)
+{
+    int cantidad = 0;
+
+    for (int f = 0; f < capa.Filas; f++)
+    {
+        const unsigned char* fila = capa.Ids + f * capa.Columnas;
+        int c = 0;
+        while (c < capa.Columnas)
+        {
+            int inicio = c;
+            while (c < capa.Columnas && fila[c] == fila[inicio]) c++;
+
+            if (Tipos[fila[inicio]].Etiqueta != 0)
+                cargar(cantidad++, f, inicio, c - inicio, (IdTile)fila[inicio]);
+        }
+    }
+
+    return cantidad;
+}
+
+int ContarTramosColision(const CapaTiles& capa)
+{
+    return RecorrerTramos(capa, [](int, int, int, int, IdTile) {});
+}
+
+int CargarTramosColision(const CapaTiles& capa, MundoColision& mundo, int desde)
+{
+    return RecorrerTramos(capa, [&](int i, int fila, int columna, int largo, IdTile id)
+    {
+        const TipoTile& tipo = Tipos[id];
+        mundo.Rects[desde + i] = {
+            capa.Origen.x + columna * TamTile,
+            capa.Origen.y + fila * TamTile - tipo.DesplazY,
+            largo * TamTile,
+            Recursos::Alto(tipo.Textura)
+        };
+        mundo.Etiquetas[desde + i] = tipo.Etiqueta;
+        mundo.Datos[desde + i] = tipo.Dato;
+    });
+}
+
+// ============================================================================
+// MALLAS POR BLOQUE
+// ============================================================================
+int ArmarVerticesBloque(const CapaTiles& capa, int bloque, IdTile tipo,
+                        float* vertices, float* uv, unsigned short* indices)
+{
+    int c0 = (bloque % capa.ColumnasBloques) * ColumnasBloque;
+    int f0 = (bloque / capa.ColumnasBloques) * FilasBloque;
+    int c1 = c0 + ColumnasBloque < capa.Columnas ? c0 + ColumnasBloque : capa.Columnas;
+    int f1 = f0 + FilasBloque < capa.Filas ? f0 + FilasBloque : capa.Filas;
+
+    const TipoTile& t = Tipos[tipo];
+    float ancho = Recursos::Ancho(t.Textura);
+    float alto = Recursos::Alto(t.Textura);
+    int cantidad = 0;
+
+    for (int f = f0; f < f1; f++)
+        for (int c = c0; c < c1; c++)
+        {
+            if (capa.Ids[f * capa.Columnas + c] != tipo) continue;
+
+            if (vertices)
+            {
+                float x = capa.Origen.x + c * TamTile;
+                float y = capa.Origen.y + f * TamTile - t.DesplazY;
+
+                // Mismo orden que los quads de raylib: no los descarta el culling
+                const float esquinas[12] = {
+                    x, y, 0,  x, y + alto, 0,  x + ancho, y + alto, 0,  x + ancho, y, 0
+                };
+                const float uvEsquinas[8] = { 0, 0,  0, 1,  1, 1,  1, 0 };
+                for (int k = 0; k < 12; k++) vertices[cantidad * 12 + k] = esquinas[k];
+                for (int k = 0; k < 8; k++) uv[cantidad * 8 + k] = uvEsquinas[k];
+
+                const unsigned short v = (unsigned short)(cantidad * 4);
+                const unsigned short quad[6] = { v, (unsigned short)(v + 1), (unsigned short)(v + 2),
+                                                 v, (unsigned short)(v + 2), (unsigned short)(v + 3) };
+                for (int k = 0; k < 6; k++) indices[cantidad * 6 + k] = quad[k];
+            }
+
+            cantidad++;
+        }
+
+    return cantidad;
+}
+
+// Vuelve a armar y subir las mallas de un bloque (índices de 16 bits: un
+// bloque de 32x16 tiles son 2048 vértices como mucho)
+static void ArmarBloque(const CapaTiles& capa, int b)
+{
+    BloqueTiles& bloque = capa.Bloques[b];
+
+    for (int t = TILE_VACIO + 1; t < TILE_CANTIDAD; t++)
+    {
+        Mesh& malla = bloque.Mallas[t];
+        if (malla.vertexCount > 0)
+        {
+            UnloadMesh(malla);
+            Recursos::Anotar(REC_MALLA, -1);
+        }
+        malla = {};
+
+        int tiles = ArmarVerticesBloque(capa, b, (IdTile)t, nullptr, nullptr, nullptr);
+        if (tiles == 0) continue;
+
+        malla.vertexCount = tiles * 4;
+        malla.triangleCount = tiles * 2;
+        malla.vertices = (float*)MemAlloc(tiles * 12 * (int)sizeof(float));
+        malla.texcoords = (float*)MemAlloc(tiles * 8 * (int)sizeof(float));
+        malla.indices = (unsigned short*)MemAlloc(tiles * 6 * (int)sizeof(unsigned short));
+        ArmarVerticesBloque(capa, b, (IdTile)t, malla.vertices, malla.texcoords, malla.indices);
+
+        UploadMesh(&malla, false);
+        Recursos::Anotar(REC_MALLA, 1);
+    }
+
+    bloque.Sucio = false;
+}
+
+// ============================================================================
+// DIBUJO
+// ============================================================================
+// Material con el shader por defecto de raylib; solo cambia la textura.
+// DrawMesh recorre todos los mapas (MAX_MATERIAL_MAPS = 12 en raylib 4.2).
+static MaterialMap MapasTiles[12] = {};
+
+void DibujarCapa(const CapaTiles& capa, Rectangle vista)
+{
+    if (!Recursos::HayGPU() || !capa.Bloques) return;
+
+    // Lo que los sprites sobresalen de su celda (hacia arriba y hacia abajo)
+    float arriba = 0, abajo = 0;
+    for (int t = TILE_VACIO + 1; t < TILE_CANTIDAD; t++)
+    {
+        float sobraAbajo = Recursos::Alto(Tipos[t].Textura) - Tipos[t].DesplazY - TamTile;
+        if (Tipos[t].DesplazY > arriba) arriba = Tipos[t].DesplazY;
+        if (sobraAbajo > abajo) abajo = sobraAbajo;
+    }
+
+    // Bloques que toca la vista
+    const float anchoBloque = ColumnasBloque * TamTile;
+    const float altoBloque = FilasBloque * TamTile;
+    int bx0 = (int)floorf((vista.x - capa.Origen.x) / anchoBloque);
+    int bx1 = (int)floorf((vista.x + vista.width - capa.Origen.x) / anchoBloque);
+    int by0 = (int)floorf((vista.y - abajo - capa.Origen.y) / altoBloque);
+    int by1 = (int)floorf((vista.y + vista.height + arriba - capa.Origen.y) / altoBloque);
+    if (bx0 < 0) bx0 = 0;
+    if (by0 < 0) by0 = 0;
+    if (bx1 >= capa.ColumnasBloques) bx1 = capa.ColumnasBloques - 1;
+    if (by1 >= capa.FilasBloques) by1 = capa.FilasBloques - 1;
+
+    Material material = {};
+    material.shader.id = rlGetShaderIdDefault();
+    material.shader.locs = rlGetShaderLocsDefault();
+    material.maps = MapasTiles;
+    MapasTiles[MATERIAL_MAP_DIFFUSE].color = WHITE;
+
+    // DrawMesh dibuja en el momento: lo que raylib tenía pendiente va debajo
+    Instanciado::VaciarLote();
+
+    for (int by = by0; by <= by1; by++)
+        for (int bx = bx0; bx <= bx1; bx++)
+        {
+            int b = by * capa.ColumnasBloques + bx;
+            if (capa.Bloques[b].Sucio) ArmarBloque(capa, b);
+
+            for (int t = TILE_VACIO + 1; t < TILE_CANTIDAD; t++)
+            {
+                const Mesh& malla = capa.Bloques[b].Mallas[t];
+                if (malla.vertexCount == 0) continue;
+
+                MapasTiles[MATERIAL_MAP_DIFFUSE].texture = Recursos::Textura(Tipos[t].Textura);
+                DrawMesh(malla, material, MatrixIdentity());
+                Instanciado::ContarLlamadas(1);
+            }
+        }
+
+    MapasTiles[MATERIAL_MAP_DIFFUSE].texture = {};
+}
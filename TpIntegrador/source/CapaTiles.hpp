@@ -0,0 +1,102 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Arena.hpp"
+#include "Recursos.hpp"
+#include "MundoColision.hpp"
+
+// ============================================================================
+// TIPOS DE TILE
+// ============================================================================
+// La capa guarda un byte por celda; todo lo demás (qué textura, cómo se
+// apoya el dibujo y con qué se choca) sale de esta tabla compartida.
+// ============================================================================
+enum IdTile : unsigned char
+{
+    TILE_VACIO,
+    TILE_SUELO,
+    TILE_PINCHOS,
+    TILE_CANTIDAD
+};
+
+struct TipoTile
+{
+    IdTextura Textura;
+    float DesplazY;             // El sprite sube esto desde el borde de la celda (los pinchos sobresalen)
+    unsigned char Etiqueta;     // EtiquetaColision (0 = no colisiona)
+    unsigned char Dato;         // Dato del colisionador (tipo de suelo, motivo de pérdida...)
+};
+
+const TipoTile& ObtenerTipoTile(IdTile id);
+
+const float TamTile = 64.0f;            // Paso de la grilla en píxeles
+const int ColumnasBloque = 32;          // Tiles por bloque (cada bloque es una malla por tipo)
+const int FilasBloque = 16;
+
+// ============================================================================
+// BLOQUE DE TILES
+// ============================================================================
+// Una malla estática por tipo de tile (Mallas[TILE_VACIO] no se usa).
+// Se vuelve a armar solo si cambió algún tile del bloque.
+// ============================================================================
+struct BloqueTiles
+{
+    Mesh Mallas[TILE_CANTIDAD];
+    bool Sucio;                 // Hay que rearmar las mallas antes de dibujar
+};
+
+// ============================================================================
+// CAPA DE TILES
+// ============================================================================
+// Grilla compacta de IdTile (fila por fila) más sus bloques, todo en la
+// ArenaNivel. La misma grilla alimenta al dibujo (mallas por bloque: pocas
+// llamadas aunque el mundo sea grande) y a la colisión (una fila de tiles
+// iguales seguidos es un solo colisionador).
+//
+// Las mallas ocupan memoria de GPU: LiberarCapa() va antes de reiniciar la
+// arena. Sin GPU (Recursos::CargarSinVentana) no se arma ninguna malla.
+// ============================================================================
+struct CapaTiles
+{
+    unsigned char* Ids;         // IdTile por celda
+    int Columnas, Filas;
+    Vector2 Origen;             // Esquina superior izquierda de la celda (0, 0)
+
+    BloqueTiles* Bloques;       // Fila por fila, igual que los tiles
+    int ColumnasBloques, FilasBloques;
+};
+
+// Copia 'ids' (columnas x filas) a la arena y deja todos los bloques por armar
+bool IniciarCapa(CapaTiles& capa, ArenaNivel& arena, const unsigned char* ids,
+                 int columnas, int filas, Vector2 origen);
+
+// Libera las mallas de la GPU (la grilla queda en la arena)
+void LiberarCapa(CapaTiles& capa);
+
+// Tile de una celda (fuera de la grilla es TILE_VACIO)
+IdTile TileEn(const CapaTiles& capa, int columna, int fila);
+
+// Cambia una celda y marca su bloque para rearmar
+void CambiarTile(CapaTiles& capa, int columna, int fila, IdTile id);
+
+// ============================================================================
+// COLISIÓN
+// ============================================================================
+// Cada tramo horizontal de tiles iguales con etiqueta es un colisionador:
+// ancho = largo del tramo, alto = alto del sprite (Recursos::Alto).
+int ContarTramosColision(const CapaTiles& capa);
+
+// Carga los tramos en el Mundo a partir de 'desde'; devuelve cuántos cargó
+int CargarTramosColision(const CapaTiles& capa, MundoColision& mundo, int desde);
+
+// ============================================================================
+// DIBUJO
+// ============================================================================
+// Arma los vértices de un tipo de tile de un bloque: 4 vértices (x, y, z) y
+// 4 UV por tile, 6 índices por tile. Devuelve la cantidad de tiles (con
+// arreglos nulos solo cuenta). Es la parte de CPU de rearmar una malla.
+int ArmarVerticesBloque(const CapaTiles& capa, int bloque, IdTile tipo,
+                        float* vertices, float* uv, unsigned short* indices);
+
+// Dibuja los bloques que tocan 'vista' (coordenadas de pantalla): una
+// llamada por tipo de tile presente en cada bloque. Rearma los sucios.
+void DibujarCapa(const CapaTiles& capa, Rectangle vista);
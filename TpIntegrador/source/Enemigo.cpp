@@ -1,70 +1,263 @@
 #include "Enemigo.hpp"
+#include "Instanciado.hpp"
 #include "raylib.h"
+#include <cmath>
+
+// Velocidades de la picada (píxeles por segundo): baja rápido, vuelve lento
+static const float VelocidadPicada = 240.0f;
+static const float VelocidadRegreso = 100.0f;
 
 // ============================================================================
-// CONSTRUCTOR  Inicializa posicin, lmites, velocidad y textura
+// CONSTRUCTOR — Inicializa posición, límites, velocidad y textura
 // ============================================================================
 Enemigo::Enemigo(float x, float y, float minX, float maxX)
 {
-    Posicion = { x, y };                // Posicin actual en pantalla
-    PosicionInicial = { x, y };         // Guardamos la posicin original
+    Posicion = { x, y };                // Posición actual en pantalla
+    PosicionInicial = { x, y };         // Guardamos la posición original
 
-    Velocidad = 80.0f;                  // Velocidad horizontal del murcilago
+    Velocidad = 80.0f;                  // Velocidad horizontal del murciélago
     VelocidadInicial = Velocidad;       // Se guarda para Reiniciar()
 
-    MinX = minX;                        // Lmite izquierdo del movimiento
-    MaxX = maxX;                        // Lmite derecho del movimiento
+    MinX = minX;                        // Límite izquierdo del movimiento
+    MaxX = maxX;                        // Límite derecho del movimiento
     MinXInicial = minX;                 // Valores originales
     MaxXInicial = maxX;
 
-    Textura = LoadTexture("Murcielago.png");    // Sprite del enemigo
+    Textura = TEX_MURCIELAGO;           // Sprite del enemigo
+
+    // Cada murciélago arranca en otro punto del aleteo según dónde aparece
+    IniciarAnimacion(Animacion, CLIP_MURCIELAGO_ALETEO, x * 0.001f);
+
+    Escala = 0.1f;          // Tamaño reducido
+
+    // Patrulla horizontal hasta que el nivel diga otra cosa
+    Comportamiento = COMP_PATRULLA;
+    MinY = MaxY = y;
+    Amplitud = 0.0f;
+    Frecuencia = 0.0f;
+    Radio = 0.0f;
+    Puntos = nullptr;
+    NumPuntos = 0;
+
+    Fase = 0.0f;
+    Picada = PICADA_PATRULLA;
+    Destino = { x, y };
+    PuntoActual = 0;
+}
+
+// ============================================================================
+// AUXILIARES DE MOVIMIENTO
+// ============================================================================
+// Avanza 'pos' con velocidad 'vel' y rebota en [min, max]
+static inline void Rebotar(float& pos, float& vel, float min, float max, float dt)
+{
+    pos += vel * dt;                    // Movimiento continuo
+
+    if (pos < min)
+    {
+        pos = min;
+        vel *= -1;                      // Cambia dirección
+    }
+    else if (pos > max)
+    {
+        pos = max;
+        vel *= -1;
+    }
+}
+
+// Acerca 'pos' a 'destino' como mucho 'paso' píxeles. true si llegó.
+static inline bool Acercar(Vector2& pos, Vector2 destino, float paso)
+{
+    float dx = destino.x - pos.x;
+    float dy = destino.y - pos.y;
+    float d2 = dx * dx + dy * dy;
+
+    if (d2 <= paso * paso)
+    {
+        pos = destino;
+        return true;
+    }
+
+    float k = paso / std::sqrt(d2);
+    pos.x += dx * k;
+    pos.y += dy * k;
+    return false;
+}
+
+// Seno de x en [0, 2 pi) con solo + - * (la política de Simulacion.hpp deja
+// afuera std::sin): se lleva a [-pi/2, pi/2] y se usa Taylor hasta x^9
+// (error menor a 4e-6, nada que se vea en un píxel)
+static inline float Seno(float x)
+{
+    const float Pi = 3.14159265f;
+
+    if (x > Pi) x -= 2 * Pi;
+    if (x > Pi / 2) x = Pi - x;
+    else if (x < -Pi / 2) x = -Pi - x;
+
+    float x2 = x * x;
+    return x * (1 - x2 * (1.0f / 6) * (1 - x2 * (1.0f / 20) * (1 - x2 * (1.0f / 42) * (1 - x2 * (1.0f / 72)))));
+}
+
+// ============================================================================
+// PATRULLA — Movimiento horizontal entre límites
+// ============================================================================
+void PatrullarEnemigos(Enemigo* enemigos, int num, float dt)
+{
+    for (int i = 0; i < num; i++)
+        Rebotar(enemigos[i].Posicion.x, enemigos[i].Velocidad, enemigos[i].MinX, enemigos[i].MaxX, dt);
+}
+
+// ============================================================================
+// VERTICAL — Sube y baja entre MinY y MaxY
+// ============================================================================
+void VolarVertical(Enemigo* enemigos, int num, float dt)
+{
+    for (int i = 0; i < num; i++)
+        Rebotar(enemigos[i].Posicion.y, enemigos[i].Velocidad, enemigos[i].MinY, enemigos[i].MaxY, dt);
+}
+
+// ============================================================================
+// ONDA — Patrulla en X; en Y sigue un seno alrededor de su altura inicial
+// ============================================================================
+void VolarEnOnda(Enemigo* enemigos, int num, float dt)
+{
+    const float DosPi = 6.28318531f;
+
+    for (int i = 0; i < num; i++)
+    {
+        Enemigo& e = enemigos[i];
+        Rebotar(e.Posicion.x, e.Velocidad, e.MinX, e.MaxX, dt);
 
-    Escala = 0.1f;          // Tamao reducido
+        // La fase se mantiene en [0, 2 pi) para no perder precisión con las horas
+        e.Fase += e.Frecuencia * DosPi * dt;
+        if (e.Fase >= DosPi) e.Fase -= DosPi;
+        e.Posicion.y = e.PosicionInicial.y + e.Amplitud * Seno(e.Fase);
+    }
 }
 
 // ============================================================================
-// UPDATE  Movimiento horizontal entre lmites
+// PICADA — Patrulla hasta ver al jugador, baja hacia donde estaba y vuelve
 // ============================================================================
-void Enemigo::Update(float dt)
+// El destino de la bajada se fija al empezarla (no lo persigue): se puede
+// esquivar. Al volver retoma la patrulla desde el punto del recorrido más
+// cercano, a su altura de siempre.
+void VolarEnPicada(Enemigo* enemigos, int num, float dt, Vector2 jugador)
 {
-    Posicion.x += Velocidad * dt;       // Movimiento continuo
+    if (num <= 0) return;
+
+    // Mismo sprite y escala para todos: el medio tamaño se calcula una vez
+    Rectangle r = enemigos[0].GetRect();
+    Vector2 medio = { r.width / 2, r.height / 2 };
 
-    // Rebote en los lmites
-    if (Posicion.x < MinX)
+    for (int i = 0; i < num; i++)
     {
-        Posicion.x = MinX;
-        Velocidad *= -1;                // Cambia direccin
+        Enemigo& e = enemigos[i];
+
+        switch (e.Picada)
+        {
+        case PICADA_PATRULLA:
+        {
+            Rebotar(e.Posicion.x, e.Velocidad, e.MinX, e.MaxX, dt);
+
+            float dx = jugador.x - (e.Posicion.x + medio.x);
+            float dy = jugador.y - (e.Posicion.y + medio.y);
+            if (dx * dx + dy * dy < e.Radio * e.Radio)
+            {
+                e.Picada = PICADA_BAJANDO;
+                e.Destino = { jugador.x - medio.x, jugador.y - medio.y };
+            }
+            break;
+        }
+
+        case PICADA_BAJANDO:
+            if (Acercar(e.Posicion, e.Destino, VelocidadPicada * dt))
+            {
+                float x = e.Posicion.x < e.MinX ? e.MinX : e.Posicion.x > e.MaxX ? e.MaxX : e.Posicion.x;
+                e.Picada = PICADA_VOLVIENDO;
+                e.Destino = { x, e.PosicionInicial.y };
+            }
+            break;
+
+        case PICADA_VOLVIENDO:
+            if (Acercar(e.Posicion, e.Destino, VelocidadRegreso * dt))
+                e.Picada = PICADA_PATRULLA;
+            break;
+        }
     }
-    else if (Posicion.x > MaxX)
+}
+
+// ============================================================================
+// RUTA — Vuela de punto en punto y vuelve a empezar
+// ============================================================================
+void SeguirRutas(Enemigo* enemigos, int num, float dt)
+{
+    for (int i = 0; i < num; i++)
     {
-        Posicion.x = MaxX;
-        Velocidad *= -1;
+        Enemigo& e = enemigos[i];
+        if (e.NumPuntos <= 0) continue;
+
+        float paso = std::fabs(e.Velocidad) * dt;
+        if (Acercar(e.Posicion, e.Puntos[e.PuntoActual], paso))
+            e.PuntoActual = (e.PuntoActual + 1) % e.NumPuntos;
     }
 }
 
 // ============================================================================
-// DRAW  Dibuja el murcilago en pantalla
+// ALETEO — El mismo para cualquier comportamiento
+// ============================================================================
+void AletearEnemigos(Enemigo* enemigos, int num, float dt)
+{
+    for (int i = 0; i < num; i++)
+        AvanzarAnimacion(enemigos[i].Animacion, dt);
+}
+
+// ============================================================================
+// DRAW — Dibuja el murciélago en pantalla
 // ============================================================================
 void Enemigo::Draw() const
 {
-    DrawTextureEx(Textura, Posicion, 0, Escala, WHITE);
+    DibujarAnimacion(Animacion, Posicion, Escala, false);
 }
 
 // ============================================================================
-// GetRect  Caja de colisin del enemigo
+// DIBUJAR EN LOTE — Todos los murciélagos del nivel
+// ============================================================================
+// La textura se busca una sola vez; por instancia solo se elige el cuadro
+// y se encola. Todos salen en una llamada instanciada.
+void DibujarEnemigos(const Enemigo* enemigos, int num)
+{
+    if (num <= 0) return;
+
+    IdTextura hoja = ObtenerClip(CLIP_MURCIELAGO_ALETEO).Hoja;
+    const Texture2D& textura = Recursos::Textura(hoja);
+
+    for (int i = 0; i < num; i++)
+    {
+        Rectangle fuente, destino;
+        RectangulosCuadro(hoja, CuadroActual(enemigos[i].Animacion), enemigos[i].Posicion,
+                          enemigos[i].Escala, false, fuente, destino);
+        Instanciado::Agregar(textura, fuente, destino, WHITE);
+    }
+
+    Instanciado::Dibujar();
+}
+
+// ============================================================================
+// GetRect — Caja de colisión del enemigo
 // ============================================================================
 Rectangle Enemigo::GetRect() const
 {
     return {
         Posicion.x,
         Posicion.y,
-        Textura.width * Escala,
-        Textura.height * Escala
+        Recursos::AnchoCuadro(Textura) * Escala,
+        Recursos::AltoCuadro(Textura) * Escala
     };
 }
 
 // ============================================================================
-// Reiniciar  Restaura el murcilago a sus valores originales
+// Reiniciar — Restaura el murciélago a sus valores originales
 // ============================================================================
 void Enemigo::Reiniciar()
 {
@@ -72,12 +265,9 @@ void Enemigo::Reiniciar()
     Velocidad = VelocidadInicial;
     MinX = MinXInicial;
     MaxX = MaxXInicial;
-}
-
-// ============================================================================
-// DESTRUCTOR  Libera la textura del enemigo
-// ============================================================================
-Enemigo::~Enemigo()
-{
-    UnloadTexture(Textura);
+    Fase = 0.0f;
+    Picada = PICADA_PATRULLA;
+    Destino = PosicionInicial;
+    PuntoActual = 0;
+    IniciarAnimacion(Animacion, CLIP_MURCIELAGO_ALETEO, PosicionInicial.x * 0.001f);
 }
\ No newline at end of file
@@ -1,46 +1,104 @@
 #pragma once
 #include "raylib.h"
+#include "Recursos.hpp"
+#include "Animacion.hpp"
 
 // ============================================================================
-// CLASE ENEMIGO (Murcilago)
+// COMPORTAMIENTOS
 // ============================================================================
-// Representa un enemigo que se mueve horizontalmente entre dos lmites.
-// El jugador pierde si colisiona con l.
-// La clase maneja: posicin, movimiento, textura y reinicio.
+// Cómo vuela cada murciélago. El Nivel los guarda agrupados por
+// comportamiento (un tramo contiguo por cada uno) y los mueve de a tramos
+// con las funciones de más abajo, sin decidir murciélago por murciélago.
+// ============================================================================
+enum ComportamientoEnemigo : unsigned char
+{
+    COMP_PATRULLA,          // De lado a lado entre MinX y MaxX (el de siempre)
+    COMP_VERTICAL,          // De arriba a abajo entre MinY y MaxY
+    COMP_ONDA,              // Patrulla subiendo y bajando en onda senoidal
+    COMP_PICADA,            // Patrulla; si el jugador entra en su radio se le tira encima
+    COMP_RUTA,              // Recorre en bucle una lista de puntos
+    COMP_CANTIDAD
+};
+
+// Fases de la picada
+enum FasePicada : unsigned char
+{
+    PICADA_PATRULLA,
+    PICADA_BAJANDO,
+    PICADA_VOLVIENDO
+};
+
+// ============================================================================
+// CLASE ENEMIGO (Murciélago)
+// ============================================================================
+// Representa un enemigo que vuela según su comportamiento.
+// El jugador pierde si colisiona con él.
+// La clase maneja: posición, parámetros de vuelo, animación y reinicio.
+// Es un dato plano: la textura la guarda el gestor de Recursos y los
+// cuadros del aleteo, la tabla compartida de Animacion.
 // ============================================================================
 class Enemigo
 {
 public:
-    Vector2 Posicion;                   // Posicin actual del enemigo en pantalla
-    Vector2 PosicionInicial;            // Posicin donde inicia (para reinicios)
+    Vector2 Posicion;                   // Posición actual del enemigo en pantalla
+    Vector2 PosicionInicial;            // Posición donde inicia (para reinicios)
 
     float Velocidad;                    // Velocidad actual de movimiento
     float VelocidadInicial;             // Velocidad original guardada para reiniciar
 
     float Escala;                       // Escalado del sprite del enemigo
 
-    // Lmites de movimiento horizontal
+    // Límites de movimiento horizontal
     float MinX, MaxX;
     float MinXInicial, MaxXInicial;
 
-    Texture2D Textura;                  // Sprite del enemigo
+    IdTextura Textura;                  // Sprite del enemigo (identificador en Recursos)
+    EstadoAnimacion Animacion;          // Aleteo (clip + tiempo)
 
-    // Constructor: define posicin inicial y rango de movimiento.
-    Enemigo(float x, float y, float minX, float maxX);
+    // --- Comportamiento (parámetros fijos; cada uno usa los suyos) ---
+    ComportamientoEnemigo Comportamiento;
+    float MinY, MaxY;                   // Vertical: límites del recorrido
+    float Amplitud;                     // Onda: píxeles arriba y abajo de PosicionInicial.y
+    float Frecuencia;                   // Onda: vueltas por segundo
+    float Radio;                        // Picada: distancia a la que ve al jugador
+    const Vector2* Puntos;              // Ruta: puntos a recorrer (en la arena del nivel)
+    int NumPuntos;
+
+    // --- Estado del comportamiento (cambia cada tick) ---
+    float Fase;                         // Onda: ángulo actual (radianes)
+    FasePicada Picada;                  // Picada: en qué parte está
+    Vector2 Destino;                    // Picada: adónde va
+    int PuntoActual;                    // Ruta: punto hacia el que vuela
 
-    // Actualiza posicin del enemigo segn deltaTime.
-    // Recorre de lado a lado entre minX y maxX.
-    void Update(float dt);
+    // Constructor: define posición inicial y rango de movimiento
+    // (patrulla horizontal; los demás comportamientos se cargan después).
+    Enemigo(float x, float y, float minX, float maxX);
 
     // Dibuja el sprite del enemigo en pantalla.
     void Draw() const;
 
-    // Devuelve el rectngulo de colisin.
+    // Calcula el rectángulo de colisión (el Nivel lo guarda en RectEnemigos
+    // y lo mueve con ActualizarEnemigos).
     Rectangle GetRect() const;
 
     // Restaura todas las variables a su estado inicial.
     void Reiniciar();
+};
+
+// ============================================================================
+// ACTUALIZACIÓN POR TRAMOS
+// ============================================================================
+// Cada función mueve 'num' murciélagos seguidos que comparten
+// comportamiento: un solo bucle, sin saltos según el tipo de cada uno.
+// El aleteo va aparte, para todos juntos (es el mismo para cualquier vuelo).
+// ============================================================================
+void PatrullarEnemigos(Enemigo* enemigos, int num, float dt);
+void VolarVertical(Enemigo* enemigos, int num, float dt);
+void VolarEnOnda(Enemigo* enemigos, int num, float dt);
+void VolarEnPicada(Enemigo* enemigos, int num, float dt, Vector2 jugador);    // 'jugador': su centro
+void SeguirRutas(Enemigo* enemigos, int num, float dt);
+void AletearEnemigos(Enemigo* enemigos, int num, float dt);
 
-    // Libera la textura asociada.
-    ~Enemigo();
-};
\ No newline at end of file
+// Dibuja 'num' murciélagos seguidos: misma textura y misma tabla de
+// cuadros para todos, en una sola llamada instanciada.
+void DibujarEnemigos(const Enemigo* enemigos, int num);
\ No newline at end of file
@@ -0,0 +1,120 @@
+﻿#include "Entrada.hpp"
+#include "raylib.h"
+#include <cstdio>
+
+// ============================================================================
+// FORMATO DE LAS GRABACIONES
+// ============================================================================
+// [Encabezado][EntradaFrame x Cantidad], todo en little-endian tal cual está
+// en memoria. Si cambia EntradaFrame hay que subir la versión.
+// ============================================================================
+struct EncabezadoGrabacion
+{
+    char Firma[4];              // "TPEN"
+    unsigned int Version;
+    unsigned int Cantidad;      // Cantidad de frames
+};
+
+static const unsigned int VersionGrabacion = 1;
+
+// ============================================================================
+// LECTURA DEL FRAME ACTUAL
+// ============================================================================
+EntradaFrame Entrada::Leer(float dt)
+{
+    EntradaFrame e = {};
+    e.Dt = dt;
+    e.Mouse = GetMousePosition();
+
+    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) e.Botones |= ENT_DERECHA;
+    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)) e.Botones |= ENT_IZQUIERDA;
+    if (IsKeyPressed(KEY_SPACE)) e.Botones |= ENT_SALTO;
+    if (IsKeyPressed(KEY_R)) e.Botones |= ENT_REINICIAR;
+    if (IsKeyPressed(KEY_M)) e.Botones |= ENT_CONTROLES;
+    if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) e.Botones |= ENT_CLICK;
+    if (IsKeyDown(KEY_BACKSPACE)) e.Botones |= ENT_REBOBINAR;
+
+    return e;
+}
+
+bool Entrada::HayActividad()
+{
+    Vector2 delta = GetMouseDelta();
+
+    return IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT) ||
+        IsKeyDown(KEY_BACKSPACE) ||
+        IsKeyPressed(KEY_SPACE) || IsKeyPressed(KEY_R) || IsKeyPressed(KEY_M) ||
+        IsMouseButtonPressed(MOUSE_LEFT_BUTTON) ||
+        delta.x != 0 || delta.y != 0;
+}
+
+EntradaJugador Entrada::Jugador(const EntradaFrame& e)
+{
+    EntradaJugador j;
+    j.Derecha = Pulsado(e, ENT_DERECHA);
+    j.Izquierda = Pulsado(e, ENT_IZQUIERDA);
+    j.Salto = Pulsado(e, ENT_SALTO);
+    return j;
+}
+
+// ============================================================================
+// GRABACIONES
+// ============================================================================
+bool Entrada::Guardar(const char* ruta, const std::vector<EntradaFrame>& frames)
+{
+    FILE* f = std::fopen(ruta, "wb");
+    if (!f)
+    {
+        TraceLog(LOG_WARNING, "ENTRADA: no se pudo escribir %s", ruta);
+        return false;
+    }
+
+    EncabezadoGrabacion enc = { { 'T', 'P', 'E', 'N' }, VersionGrabacion, (unsigned int)frames.size() };
+    bool ok = std::fwrite(&enc, sizeof(enc), 1, f) == 1;
+    if (ok && !frames.empty())
+        ok = std::fwrite(frames.data(), sizeof(EntradaFrame), frames.size(), f) == frames.size();
+
+    std::fclose(f);
+    return ok;
+}
+
+// Bytes que quedan en el archivo desde la posición actual
+static long BytesRestantes(FILE* f)
+{
+    long actual = std::ftell(f);
+    if (actual < 0 || std::fseek(f, 0, SEEK_END) != 0) return 0;
+    long fin = std::ftell(f);
+    std::fseek(f, actual, SEEK_SET);
+    return fin > actual ? fin - actual : 0;
+}
+
+bool Entrada::Cargar(const char* ruta, std::vector<EntradaFrame>& frames)
+{
+    FILE* f = std::fopen(ruta, "rb");
+    if (!f)
+    {
+        TraceLog(LOG_WARNING, "ENTRADA: no se encontró %s", ruta);
+        return false;
+    }
+
+    EncabezadoGrabacion enc;
+    bool ok = std::fread(&enc, sizeof(enc), 1, f) == 1 &&
+        enc.Firma[0] == 'T' && enc.Firma[1] == 'P' && enc.Firma[2] == 'E' && enc.Firma[3] == 'N' &&
+        enc.Version == VersionGrabacion;
+
+    // La cantidad viene del archivo: tiene que entrar en lo que queda de él
+    // antes de reservar nada
+    ok = ok && enc.Cantidad <= (unsigned long)BytesRestantes(f) / sizeof(EntradaFrame);
+
+    if (ok)
+    {
+        frames.resize(enc.Cantidad);
+        if (enc.Cantidad > 0)
+            ok = std::fread(frames.data(), sizeof(EntradaFrame), enc.Cantidad, f) == enc.Cantidad;
+    }
+
+    if (!ok) TraceLog(LOG_WARNING, "ENTRADA: %s no es una grabación válida", ruta);
+
+    std::fclose(f);
+    return ok;
+}
@@ -0,0 +1,64 @@
+﻿#pragma once
+#include "raylib.h"
+#include "FisicaJugador.hpp"
+#include <vector>
+
+// ============================================================================
+// BOTONES DE UN FRAME
+// ============================================================================
+// Todo lo que el juego consulta del teclado y el mouse, como bits.
+// Los "Pulso" son flancos (IsKeyPressed / IsMouseButtonPressed); el resto
+// son teclas mantenidas (IsKeyDown).
+// ============================================================================
+enum BotonEntrada : unsigned short
+{
+    ENT_DERECHA = 1 << 0,       // Mantiene D / flecha derecha
+    ENT_IZQUIERDA = 1 << 1,     // Mantiene A / flecha izquierda
+    ENT_SALTO = 1 << 2,         // Pulsó ESPACIO
+    ENT_REINICIAR = 1 << 3,     // Pulsó R
+    ENT_CONTROLES = 1 << 4,     // Pulsó M
+    ENT_CLICK = 1 << 5,         // Pulsó el botón izquierdo del mouse
+    ENT_REBOBINAR = 1 << 6      // Mantiene BACKSPACE
+};
+
+// ============================================================================
+// ENTRADA DE UN FRAME
+// ============================================================================
+// El juego no lee raylib directamente: recibe esto una vez por frame.
+// Así la misma partida se puede jugar con el teclado, grabar a un archivo
+// y reproducirla después frame por frame (con el mismo dt).
+// ============================================================================
+struct EntradaFrame
+{
+    float Dt;                   // Duración del frame en segundos
+    Vector2 Mouse;              // Posición del cursor
+    unsigned short Botones;     // Combinación de BotonEntrada
+    unsigned short Reservado;   // Relleno explícito (el archivo guarda la estructura tal cual)
+};
+
+static_assert(sizeof(EntradaFrame) == 16, "EntradaFrame cambia el formato de las grabaciones");
+
+inline bool Pulsado(const EntradaFrame& e, BotonEntrada boton)
+{
+    return (e.Botones & boton) != 0;
+}
+
+namespace Entrada
+{
+    // Lee teclado y mouse del frame actual; 'dt' es la duración del frame
+    // (Ritmo::Dt)
+    EntradaFrame Leer(float dt);
+
+    // true si desde el último sondeo hubo algo que el juego atiende (teclas,
+    // click o movimiento del mouse). No consume flancos: se puede consultar
+    // entre sondeos sin que Leer() pierda nada.
+    bool HayActividad();
+
+    // Traduce la entrada del frame a la del paso de física del jugador
+    EntradaJugador Jugador(const EntradaFrame& e);
+
+    // Grabaciones: un encabezado y después los frames en orden.
+    // Devuelven false si no se pudo abrir el archivo o el formato no coincide.
+    bool Guardar(const char* ruta, const std::vector<EntradaFrame>& frames);
+    bool Cargar(const char* ruta, std::vector<EntradaFrame>& frames);
+}
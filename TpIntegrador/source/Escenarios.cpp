@@ -1,42 +1,66 @@
 ﻿#include "Escenarios.hpp"
+#include "Instanciado.hpp"
 #include "raylib.h"
 
+// Toda la pantalla: lo que la vista deja afuera de la capa no se dibuja
+static Rectangle VistaPantalla()
+{
+    return { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
+}
+
 // ============================================================================
 // ESCENARIO BASE DEL NIVEL
 // ============================================================================
 
+// Un sprite entero de 'textura' escalado dentro de 'destino'
+static void AgregarSprite(const Texture2D& textura, Rectangle destino, Color tinte)
+{
+    Instanciado::Agregar(textura, { 0, 0, (float)textura.width, (float)textura.height }, destino, tinte);
+}
+
 // Dibuja el fondo, árbol decorativo, suelo inicial, pinchos, plataformas y cajas.
 // Es la vista principal utilizada durante el gameplay.
+// El terreno sale de las mallas de la capa (una llamada por tipo de tile y
+// bloque); plataformas y cajas van instanciados y encolados por tipo, así
+// cada textura es una llamada.
 void EscenarioBase(
-    Texture2D TexturaFondo,
-    Texture2D TexturaSuelo,
-    Texture2D TexturaPinchos,
+    const FondoParallax& Fondo,
     Texture2D TexturaArbol,
-    const std::vector<Plataforma*>& plataformas,
-    const std::vector<Caja*>& cajas,
-    int TilesNecesarios
+    const Nivel& nivel
 )
 {
-    // Fondo completo
-    DrawTexture(TexturaFondo, 0, 0, WHITE);
+    // Fondo completo: un quad por capa, corrido según la vista
+    DibujarParallax(Fondo, VistaPantalla());
 
     // Árbol decorativo (escalado y ajustado al suelo)
     float escalaArbol = 0.8f;
     DrawTextureEx(TexturaArbol, { 5, 640 - (TexturaArbol.height * escalaArbol) }, 0, escalaArbol, WHITE);
 
-    // Primeros 5 tiles = suelo → caminable
-    for (int i = 0; i < 5; i++)
-        DrawTexture(TexturaSuelo, i * 64.0f, 640, WHITE);
-
-    // Resto del suelo = pinchos → zona peligrosa
-    for (int i = 5; i < TilesNecesarios; i++)
-        DrawTexture(TexturaPinchos, i * 64.0f, 623, WHITE);
-
-    // Plataformas del nivel
-    for (auto* p : plataformas) p->Draw();
+    // Terreno: suelo caminable y pinchos
+    DibujarCapa(nivel.Terreno, VistaPantalla());
+
+    // Plataformas del nivel (el rectángulo de colisión es el del sprite escalado)
+    for (int i = 0; i < nivel.NumPlataformas; i++)
+    {
+        const Plataforma& p = nivel.Plataformas[i];
+        AgregarSprite(Recursos::Textura(p.Textura), nivel.RectPlataformas[i], p.Tinte);
+    }
+    for (int i = 0; i < nivel.NumPlataformasUnaVia; i++)
+    {
+        const Plataforma& p = nivel.PlataformasUnaVia[i];
+        AgregarSprite(Recursos::Textura(p.Textura), nivel.RectUnaVia[i], p.Tinte);
+    }
+    for (int i = 0; i < nivel.NumPlataformasMoviles; i++)
+    {
+        const Plataforma& p = nivel.PlataformasMoviles[i].Base;
+        AgregarSprite(Recursos::Textura(p.Textura), nivel.RectMoviles[i], p.Tinte);
+    }
 
     // Cajas
-    for (auto* c : cajas) c->Draw();
+    for (int i = 0; i < nivel.NumCajas; i++)
+        AgregarSprite(Recursos::Textura(nivel.Cajas[i].Textura), nivel.RectCajas[i], WHITE);
+
+    Instanciado::Dibujar();
 }
 
 // ============================================================================
@@ -44,13 +68,12 @@ void EscenarioBase(
 // ============================================================================
 
 // Se dibuja suelo completo normal (sin pinchos ni árbol).
-void EscenarioFinalGanaste(Texture2D TexturaFondo, Texture2D TexturaSuelo, int TilesNecesarios)
+void EscenarioFinalGanaste(Texture2D TexturaFondo, const CapaTiles& Suelo)
 {
     DrawTexture(TexturaFondo, 0, 0, WHITE);
 
     // Suelo completo caminable
-    for (int i = 0; i < TilesNecesarios; i++)
-        DrawTexture(TexturaSuelo, i * 64.0f, 640, WHITE);
+    DibujarCapa(Suelo, VistaPantalla());
 }
 
 // ============================================================================
@@ -60,15 +83,13 @@ void EscenarioFinalGanaste(Texture2D TexturaFondo, Texture2D TexturaSuelo, int T
 // Todo el suelo se reemplaza por pinchos (estético, no colisiona aquí).
 void EscenarioFinalPerdiste(
     Texture2D TexturaFondo,
-    Texture2D TexturaPinchos,
-    int TilesNecesarios
+    const CapaTiles& Pinchos
 )
 {
     DrawTexture(TexturaFondo, 0, 0, WHITE);
 
     // Suelo completo de pinchos
-    for (int i = 0; i < TilesNecesarios; i++)
-        DrawTexture(TexturaPinchos, i * 64.0f, 623, WHITE);
+    DibujarCapa(Pinchos, VistaPantalla());
 }
 
 // ============================================================================
@@ -100,7 +121,7 @@ void DibujarHUD(
     // POSICIÓN DEL JUGADOR
     DrawTextureEx(TexturaPosicion, { 10, 10 }, 0, 0.1f, WHITE);
     DrawTextEx(PixelFont,
-        TextFormat("X:%i Y:%i", (int)Jugador.Posicion.x, (int)Jugador.Posicion.y),
+        TextFormat("X:%i Y:%i", (int)Jugador.Fisica.Posicion.x, (int)Jugador.Fisica.Posicion.y),
         { 50, 25 },
         15,
         0,
@@ -109,7 +130,7 @@ void DibujarHUD(
 
     // CONTADOR DE SALTOS
     DrawTextureEx(TexturaSaltos, { 844, 690 }, 0, 0.08f, WHITE);
-    const char* saltoStr = TextFormat("%i|10", Jugador.ContadorSaltos);
+    const char* saltoStr = TextFormat("%i|10", Jugador.Fisica.ContadorSaltos);
 
     Vector2 sizeSaltos = MeasureTextEx(PixelFont, saltoStr, 14, 1);
 
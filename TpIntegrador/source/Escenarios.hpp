@@ -2,23 +2,19 @@
 #define ESCENARIOS_HPP
 
 #include "raylib.h"
-#include "Plataforma.hpp"
-#include "Caja.hpp"
+#include "Nivel.hpp"
+#include "CapaTiles.hpp"
 #include "Player.hpp"
-#include <vector>
+#include "Parallax.hpp"
 
 // ============================================================================
-// ESCENARIO BASE (fondo + suelo + pinchos + plataformas + cajas)
+// ESCENARIO BASE (fondo en capas + suelo + pinchos + plataformas + cajas)
 // Llamado durante el estado JUGANDO y en transiciones.
 // ============================================================================
 void EscenarioBase(
-    Texture2D TexturaFondo,
-    Texture2D TexturaSuelo,
-    Texture2D TexturaPinchos,
+    const FondoParallax& Fondo,
     Texture2D TexturaArbol,
-    const std::vector<Plataforma*>& plataformas,
-    const std::vector<Caja*>& cajas,
-    int TilesNecesarios
+    const Nivel& nivel
 );
 
 // ============================================================================
@@ -27,8 +23,7 @@ void EscenarioBase(
 // ============================================================================
 void EscenarioFinalGanaste(
     Texture2D TexturaFondo,
-    Texture2D TexturaSuelo,
-    int TilesNecesarios
+    const CapaTiles& Suelo
 );
 
 // ============================================================================
@@ -37,8 +32,7 @@ void EscenarioFinalGanaste(
 // ============================================================================
 void EscenarioFinalPerdiste(
     Texture2D TexturaFondo,
-    Texture2D TexturaPinchos,
-    int TilesNecesarios
+    const CapaTiles& Pinchos
 );
 
 // ============================================================================
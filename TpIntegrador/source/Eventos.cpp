@@ -0,0 +1,38 @@
+﻿#include "Eventos.hpp"
+
+// ============================================================================
+// COLA DEL FRAME
+// ============================================================================
+void IniciarEventos(ColaEventos& cola)
+{
+    cola.Escritos = 0;
+    cola.InicioFrame = 0;
+    cola.Perdidos = 0;
+}
+
+void NuevoFrameEventos(ColaEventos& cola)
+{
+    cola.InicioFrame = cola.Escritos;
+}
+
+void PublicarEvento(ColaEventos& cola, TipoEvento tipo, unsigned char dato, Vector2 posicion)
+{
+    // El anillo ya está lleno de eventos de este frame: se pisa el más viejo
+    if (cola.Escritos - cola.InicioFrame >= (unsigned int)CapacidadEventos)
+        cola.Perdidos++;
+
+    cola.Anillo[cola.Escritos % CapacidadEventos] = { tipo, dato, posicion };
+    cola.Escritos++;
+}
+
+int NumEventosFrame(const ColaEventos& cola)
+{
+    unsigned int n = cola.Escritos - cola.InicioFrame;
+    return n < (unsigned int)CapacidadEventos ? (int)n : CapacidadEventos;
+}
+
+const Evento& EventoFrame(const ColaEventos& cola, int i)
+{
+    unsigned int primero = cola.Escritos - (unsigned int)NumEventosFrame(cola);
+    return cola.Anillo[(primero + (unsigned int)i) % CapacidadEventos];
+}
@@ -0,0 +1,68 @@
+﻿#pragma once
+#include "raylib.h"
+
+// ============================================================================
+// EVENTOS DE JUEGO
+// ============================================================================
+// Lo que pasó en un frame, contado una sola vez: la simulación y las
+// pantallas publican eventos tipados y los sistemas que reaccionan (audio,
+// y más adelante efectos, estadísticas o telemetría) los recorren todos
+// juntos al final del frame. Quien publica no sabe quién escucha; una
+// corrida sin ventana simplemente no pasa cola y no hay efectos.
+// ============================================================================
+enum TipoEvento : unsigned char
+{
+    EV_SALTO,               // Dato: TipoSuelo desde el que despegó
+    EV_PISADA,              // Dato: TipoSuelo (un paso de los que suenan)
+    EV_ATERRIZAJE,          // Dato: TipoSuelo donde cayó
+    EV_VICTORIA,            // Se abrió la puerta
+    EV_DERROTA,             // Dato: MotivoPerdida
+    EV_BOTON_ENCIMA,        // Dato: IdBoton (el cursor acaba de entrar)
+    EV_BOTON_PULSADO,       // Dato: IdBoton
+    EV_CANTIDAD
+};
+
+// Botones de las pantallas (y la tecla R, que hace lo mismo que uno)
+enum IdBoton : unsigned char
+{
+    BOTON_PLAY,
+    BOTON_EXIT,
+    BOTON_REINTENTAR,
+    BOTON_MENU,
+    BOTON_REINICIAR
+};
+
+struct Evento
+{
+    TipoEvento Tipo;
+    unsigned char Dato;
+    Vector2 Posicion;       // Dónde pasó (los pies del jugador, el cursor...)
+};
+
+// ============================================================================
+// COLA DEL FRAME (ANILLO)
+// ============================================================================
+// Tamaño fijo, sin reservas. Los eventos del frame son los publicados
+// desde NuevoFrameEventos(); si en un frame se publican más que la
+// capacidad, se pisan los más viejos y se cuentan en Perdidos.
+// ============================================================================
+const int CapacidadEventos = 64;
+
+struct ColaEventos
+{
+    Evento Anillo[CapacidadEventos];
+    unsigned int Escritos;      // Total publicados (el próximo va en Escritos % CapacidadEventos)
+    unsigned int InicioFrame;   // Escritos al empezar el frame
+    unsigned int Perdidos;      // Pisados antes de que se consumieran
+};
+
+void IniciarEventos(ColaEventos& cola);
+
+// Empieza un frame: lo publicado antes ya no cuenta
+void NuevoFrameEventos(ColaEventos& cola);
+
+void PublicarEvento(ColaEventos& cola, TipoEvento tipo, unsigned char dato = 0, Vector2 posicion = { 0, 0 });
+
+// Eventos del frame actual, del más viejo (0) al más nuevo
+int NumEventosFrame(const ColaEventos& cola);
+const Evento& EventoFrame(const ColaEventos& cola, int i);
@@ -0,0 +1,272 @@
+﻿#include "Fantasma.hpp"
+#include <cmath>
+#include <cstdio>
+
+// ============================================================================
+// FORMATO
+// ============================================================================
+enum CabeceraFantasma : unsigned char
+{
+    FAN_ABSOLUTA = 1 << 0,      // Posición completa en lugar de delta
+    FAN_POSE = 1 << 1,          // Sigue un byte de pose
+    FAN_QUIETO = 1 << 2         // Misma posición que el tick anterior (sin bytes)
+};
+
+const float CuartosPorPixel = 4.0f;
+
+// Pose en un byte: clip (2 bits), cuadro (4 bits), mirando a la derecha (1 bit)
+static unsigned char ArmarPose(const EstadoJugador& fisica, const EstadoAnimacion& animacion)
+{
+    const ClipAnimacion& clip = ObtenerClip(animacion.Clip);
+    int cuadro = (int)(&CuadroActual(animacion) - clip.Cuadros);
+    return (unsigned char)((animacion.Clip & 3) | (cuadro & 15) << 2 | (fisica.MirandoDerecha ? 1 << 6 : 0));
+}
+
+static void Escribir16(std::vector<unsigned char>& d, int v)
+{
+    d.push_back((unsigned char)(v & 0xFF));
+    d.push_back((unsigned char)((v >> 8) & 0xFF));
+}
+
+static int Leer16(const unsigned char* p)
+{
+    return (short)(p[0] | p[1] << 8);
+}
+
+// Decodifica el registro en l.Desplazamiento. false si está cortado.
+static bool DecodificarRegistro(const std::vector<unsigned char>& d, LectorFantasma& l)
+{
+    int n = (int)d.size();
+    int i = l.Desplazamiento;
+    if (i >= n) return false;
+
+    unsigned char cabecera = d[i++];
+    if (cabecera & FAN_ABSOLUTA)
+    {
+        if (i + 4 > n) return false;
+        l.X = Leer16(&d[i]);
+        l.Y = Leer16(&d[i + 2]);
+        i += 4;
+    }
+    else if (!(cabecera & FAN_QUIETO))
+    {
+        if (i + 2 > n) return false;
+        l.X += (signed char)d[i];
+        l.Y += (signed char)d[i + 1];
+        i += 2;
+    }
+
+    if (cabecera & FAN_POSE)
+    {
+        if (i + 1 > n) return false;
+        l.Pose = d[i++];
+    }
+
+    l.Desplazamiento = i;
+    l.Tick++;
+    return true;
+}
+
+// ============================================================================
+// GRABACIÓN
+// ============================================================================
+void VaciarTrayectoria(TrayectoriaFantasma& t, int ticksReservados)
+{
+    t.Datos.clear();
+    t.Datos.reserve(ticksReservados * 3 + ticksReservados / IntervaloClave * 4);
+    t.Claves.clear();
+    t.Claves.reserve(ticksReservados / IntervaloClave + 1);
+    t.Ticks = 0;
+    t.UltimoX = t.UltimoY = 0;
+    t.UltimaPose = 0;
+}
+
+void GrabarTickFantasma(TrayectoriaFantasma& t, const EstadoJugador& fisica,
+                        const EstadoAnimacion& animacion)
+{
+    int x = (int)std::lround(fisica.Posicion.x * CuartosPorPixel);
+    int y = (int)std::lround(fisica.Posicion.y * CuartosPorPixel);
+    unsigned char pose = ArmarPose(fisica, animacion);
+
+    int dx = x - t.UltimoX;
+    int dy = y - t.UltimoY;
+    bool clave = t.Ticks % IntervaloClave == 0;
+
+    unsigned char cabecera = 0;
+    if (clave || dx < -128 || dx > 127 || dy < -128 || dy > 127) cabecera |= FAN_ABSOLUTA;
+    else if (dx == 0 && dy == 0) cabecera |= FAN_QUIETO;
+    if (clave || pose != t.UltimaPose) cabecera |= FAN_POSE;
+
+    if (clave) t.Claves.push_back((int)t.Datos.size());
+    t.Datos.push_back(cabecera);
+
+    if (cabecera & FAN_ABSOLUTA)
+    {
+        Escribir16(t.Datos, x);
+        Escribir16(t.Datos, y);
+    }
+    else if (!(cabecera & FAN_QUIETO))
+    {
+        t.Datos.push_back((unsigned char)(signed char)dx);
+        t.Datos.push_back((unsigned char)(signed char)dy);
+    }
+
+    if (cabecera & FAN_POSE) t.Datos.push_back(pose);
+
+    t.UltimoX = x;
+    t.UltimoY = y;
+    t.UltimaPose = pose;
+    t.Ticks++;
+}
+
+// ============================================================================
+// REPRODUCCIÓN
+// ============================================================================
+void ReiniciarLector(LectorFantasma& l)
+{
+    l.Tick = -1;
+    l.Desplazamiento = 0;
+    l.X = l.Y = 0;
+    l.Pose = 0;
+}
+
+bool LeerTickFantasma(const TrayectoriaFantasma& t, LectorFantasma& l, int tick, MuestraFantasma& m)
+{
+    if (tick < 0 || tick >= t.Ticks) return false;
+
+    // Hacia atrás o muy adelante: se salta a la clave anterior
+    if (tick <= l.Tick || tick - l.Tick > IntervaloClave)
+    {
+        int clave = tick / IntervaloClave;
+        l.Tick = clave * IntervaloClave - 1;
+        l.Desplazamiento = t.Claves[clave];
+    }
+
+    while (l.Tick < tick)
+        if (!DecodificarRegistro(t.Datos, l)) return false;
+
+    m.Posicion = { l.X / CuartosPorPixel, l.Y / CuartosPorPixel };
+    m.Clip = (IdClip)(l.Pose & 3);
+    m.Cuadro = (unsigned char)((l.Pose >> 2) & 15);
+    m.MirandoDerecha = (l.Pose & (1 << 6)) != 0;
+    return true;
+}
+
+void DibujarFantasma(const MuestraFantasma& m, float escala, Color tinte)
+{
+    const ClipAnimacion& clip = ObtenerClip(m.Clip);
+    int cuadro = m.Cuadro < clip.NumCuadros ? m.Cuadro : clip.NumCuadros - 1;
+    DibujarCuadro(Recursos::Textura(clip.Hoja), clip.Hoja, clip.Cuadros[cuadro],
+        m.Posicion, escala, !m.MirandoDerecha, tinte);
+}
+
+// ============================================================================
+// ARCHIVO DE LA MEJOR CARRERA
+// ============================================================================
+struct EncabezadoCarrera
+{
+    char Firma[4];              // "TPFA"
+    unsigned int Version;
+    int IdNivel;
+    float Tiempo;
+    unsigned int Ticks;         // Entradas y registros de la trayectoria
+    unsigned int Bytes;         // Tamaño de la trayectoria
+};
+
+static const unsigned int VersionCarrera = 1;
+
+bool GuardarMejorCarrera(const char* ruta, const MejorCarrera& c)
+{
+    FILE* f = std::fopen(ruta, "wb");
+    if (!f)
+    {
+        TraceLog(LOG_WARNING, "FANTASMA: no se pudo escribir %s", ruta);
+        return false;
+    }
+
+    const TrayectoriaFantasma& t = c.Trayectoria;
+    EncabezadoCarrera enc = { { 'T', 'P', 'F', 'A' }, VersionCarrera, c.IdNivel, c.Tiempo,
+        (unsigned int)t.Ticks, (unsigned int)t.Datos.size() };
+
+    bool ok = (int)c.Entradas.size() == t.Ticks && std::fwrite(&enc, sizeof(enc), 1, f) == 1;
+    if (ok && t.Ticks > 0)
+        ok = std::fwrite(c.Entradas.data(), sizeof(EntradaFrame), t.Ticks, f) == (size_t)t.Ticks &&
+             std::fwrite(t.Datos.data(), 1, t.Datos.size(), f) == t.Datos.size();
+
+    std::fclose(f);
+    return ok;
+}
+
+// Bytes que quedan en el archivo desde la posición actual
+static long BytesRestantes(FILE* f)
+{
+    long actual = std::ftell(f);
+    if (actual < 0 || std::fseek(f, 0, SEEK_END) != 0) return 0;
+    long fin = std::ftell(f);
+    std::fseek(f, actual, SEEK_SET);
+    return fin > actual ? fin - actual : 0;
+}
+
+bool CargarMejorCarrera(const char* ruta, MejorCarrera& c)
+{
+    FILE* f = std::fopen(ruta, "rb");
+    if (!f) return false;       // Todavía no hay récord: no es un error
+
+    EncabezadoCarrera enc;
+    bool ok = std::fread(&enc, sizeof(enc), 1, f) == 1 &&
+        enc.Firma[0] == 'T' && enc.Firma[1] == 'P' && enc.Firma[2] == 'F' && enc.Firma[3] == 'A' &&
+        enc.Version == VersionCarrera;
+
+    // Los tamaños vienen del archivo: las entradas y los registros tienen
+    // que entrar en lo que queda de él antes de reservar nada
+    if (ok)
+    {
+        unsigned long long resto = (unsigned long long)BytesRestantes(f);
+        unsigned long long pedido = (unsigned long long)enc.Ticks * sizeof(EntradaFrame) + enc.Bytes;
+        ok = pedido <= resto;
+    }
+
+    TrayectoriaFantasma& t = c.Trayectoria;
+    if (ok)
+    {
+        c.IdNivel = enc.IdNivel;
+        c.Tiempo = enc.Tiempo;
+        c.Entradas.resize(enc.Ticks);
+        VaciarTrayectoria(t, (int)enc.Ticks);
+        t.Datos.resize(enc.Bytes);
+
+        if (enc.Ticks > 0)
+            ok = std::fread(c.Entradas.data(), sizeof(EntradaFrame), enc.Ticks, f) == enc.Ticks &&
+                 std::fread(t.Datos.data(), 1, enc.Bytes, f) == enc.Bytes;
+    }
+
+    // Recorre los registros una vez: los valida y arma la tabla de claves
+    if (ok)
+    {
+        LectorFantasma l;
+        ReiniciarLector(l);
+        for (unsigned int i = 0; ok && i < enc.Ticks; i++)
+        {
+            if (i % IntervaloClave == 0)
+            {
+                t.Claves.push_back(l.Desplazamiento);
+                ok = l.Desplazamiento < (int)t.Datos.size() && (t.Datos[l.Desplazamiento] & FAN_ABSOLUTA);
+            }
+            ok = ok && DecodificarRegistro(t.Datos, l);
+        }
+        t.Ticks = (int)enc.Ticks;
+        t.UltimoX = l.X;
+        t.UltimoY = l.Y;
+        t.UltimaPose = l.Pose;
+    }
+
+    if (!ok)
+    {
+        TraceLog(LOG_WARNING, "FANTASMA: %s no es una carrera válida", ruta);
+        c.Entradas.clear();
+        VaciarTrayectoria(t, 0);
+    }
+
+    std::fclose(f);
+    return ok;
+}
@@ -0,0 +1,87 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Animacion.hpp"
+#include "FisicaJugador.hpp"
+#include "Entrada.hpp"
+#include <vector>
+
+// ============================================================================
+// TRAYECTORIA DEL FANTASMA
+// ============================================================================
+// Lo justo para dibujar al caballero de una carrera anterior, una muestra
+// por tick: posición, clip, cuadro y hacia dónde mira. Reproducirla no
+// vuelve a simular nada: es leer unos bytes por tick.
+//
+// Un registro por tick:
+//   cabecera (byte)  combinación de FAN_ABSOLUTA, FAN_POSE y FAN_QUIETO
+//   FAN_ABSOLUTA  -> x, y (short, en cuartos de píxel)
+//   si no y sin FAN_QUIETO -> dx, dy (signed char, en cuartos de píxel)
+//   FAN_POSE      -> pose (clip, cuadro y si mira a la derecha)
+// Cada IntervaloClave ticks va un registro clave (posición absoluta y
+// pose): saltar a cualquier tick (rebobinado) decodifica a lo sumo
+// IntervaloClave registros. Caminando son 3 bytes por tick; quieto, 1.
+// ============================================================================
+const int IntervaloClave = 60;
+
+struct MuestraFantasma
+{
+    Vector2 Posicion;
+    IdClip Clip;
+    unsigned char Cuadro;
+    bool MirandoDerecha;
+};
+
+struct TrayectoriaFantasma
+{
+    std::vector<unsigned char> Datos;
+    std::vector<int> Claves;        // Posición en Datos de cada registro clave
+    int Ticks;
+
+    // Último registro escrito (los deltas salen de acá)
+    int UltimoX, UltimoY;
+    unsigned char UltimaPose;
+};
+
+// Deja la trayectoria vacía con lugar para 'ticksReservados' sin realocar
+void VaciarTrayectoria(TrayectoriaFantasma& t, int ticksReservados);
+
+// Agrega la muestra del tick que acaba de terminar
+void GrabarTickFantasma(TrayectoriaFantasma& t, const EstadoJugador& fisica,
+                        const EstadoAnimacion& animacion);
+
+// Cursor de lectura: avanzar de a un tick es decodificar un registro
+struct LectorFantasma
+{
+    int Tick;                       // Último tick decodificado (-1: ninguno)
+    int Desplazamiento;             // Próximo registro en Datos
+    int X, Y;
+    unsigned char Pose;
+};
+
+void ReiniciarLector(LectorFantasma& l);
+
+// Muestra del tick 'tick' (0 = el primero grabado). Devuelve false si la
+// trayectoria no llega a ese tick.
+bool LeerTickFantasma(const TrayectoriaFantasma& t, LectorFantasma& l, int tick, MuestraFantasma& m);
+
+// Dibuja al caballero de la muestra con 'tinte' (translúcido)
+void DibujarFantasma(const MuestraFantasma& m, float escala, Color tinte);
+
+// ============================================================================
+// MEJOR CARRERA
+// ============================================================================
+// El mejor tiempo de un nivel junto con la entrada de cada tick (con la
+// simulación determinista alcanza para reproducir la carrera exacta) y la
+// trayectoria ya comprimida para el fantasma.
+// ============================================================================
+struct MejorCarrera
+{
+    int IdNivel;
+    float Tiempo;
+    std::vector<EntradaFrame> Entradas;     // Una por tick (Dt = DtTick)
+    TrayectoriaFantasma Trayectoria;
+};
+
+// Devuelven false si no se pudo abrir el archivo o el formato no coincide
+bool GuardarMejorCarrera(const char* ruta, const MejorCarrera& c);
+bool CargarMejorCarrera(const char* ruta, MejorCarrera& c);
@@ -0,0 +1,196 @@
+﻿#include "FisicaJugador.hpp"
+#include "Nivel.hpp"
+#include "raylib.h"
+
+// ============================================================================
+// ESTADO INICIAL (posición de aparición del nivel)
+// ============================================================================
+void IniciarEstadoJugador(EstadoJugador& e, float ancho, float alto)
+{
+    e.Posicion = { 25.0f, 568.0f };
+    e.Velocidad = { 0.0f, 0.0f };
+    e.Ancho = ancho;
+    e.Alto = alto;
+    e.BufferSalto = 0;
+    e.ContadorSaltos = 0;
+    e.EnSuelo = false;
+    e.TipoActual = SUELO_AIRE;
+    e.MirandoDerecha = true;
+    e.Moviendo = false;
+    e.Apoyo = -1;
+}
+
+// ============================================================================
+// RECTÁNGULO DE COLISIÓN DEL JUGADOR
+// ============================================================================
+Rectangle RectJugador(const EstadoJugador& e)
+{
+    // Se recorta horizontalmente para ajustar mejor al sprite
+    float margen = e.Ancho * 0.26f;
+    return { e.Posicion.x + margen, e.Posicion.y, e.Ancho - margen * 2, e.Alto };
+}
+
+// ============================================================================
+// SALTO DEL JUGADOR
+// ============================================================================
+static bool Saltar(EstadoJugador& e)
+{
+    const float FuerzaSalto = 450.0f;
+
+    if (!e.EnSuelo) return false;
+
+    e.Velocidad.y = -FuerzaSalto;
+    e.EnSuelo = false;
+    e.ContadorSaltos++;
+    return true;
+}
+
+// ============================================================================
+// PASO DE FÍSICA
+// ============================================================================
+// Distancia (px) por debajo de los pies en la que una superficie todavía
+// cuenta como apoyo
+static const float ToleranciaApoyo = 0.5f;
+
+unsigned char PasoFisicoJugador(EstadoJugador& e, const EntradaJugador& entrada,
+                                float dt, const Nivel& nivel)
+{
+    unsigned char sucesos = PASO_NINGUNO;
+
+    float velMov = 200.0f;
+    e.Velocidad.x = 0;
+
+    if (e.BufferSalto > 0) e.BufferSalto -= dt;
+
+    // --- MOVIMIENTO HORIZONTAL ---
+    e.Moviendo = false;
+
+    if (entrada.Derecha)
+    {
+        e.Velocidad.x = velMov;
+        e.MirandoDerecha = true;
+        e.Moviendo = true;
+    }
+    if (entrada.Izquierda)
+    {
+        e.Velocidad.x = -velMov;
+        e.MirandoDerecha = false;
+        e.Moviendo = true;
+    }
+
+    // Buffer para salto más responsivo
+    if (entrada.Salto)
+        e.BufferSalto = 0.12f;
+
+    // Gravedad
+    if (!e.EnSuelo)
+        e.Velocidad.y += 900 * dt;
+
+    // Altura de los pies al empezar el tick (antes de cualquier movimiento)
+    Rectangle r = RectJugador(e);
+    float pieAntes = r.y + r.height;
+
+    // --- ARRASTRE: lo que tiene debajo ya se movió en este tick ---
+    const MundoColision& mundo = nivel.Mundo;
+    if (e.EnSuelo && e.Apoyo >= mundo.NumEstaticos)
+    {
+        const Vector2& d = mundo.Desplazamientos[e.Apoyo - mundo.NumEstaticos];
+        e.Posicion.x += d.x;
+        e.Posicion.y += d.y;
+    }
+
+    // --- CANDIDATOS: una sola consulta al mundo para todo el paso ---
+    // Cubre la posición actual y la prevista en ambos ejes, más un ancho de
+    // margen para los empujes hacia atrás al resolver en X.
+    r = RectJugador(e);
+    float x0 = r.x + (e.Velocidad.x < 0 ? e.Velocidad.x * dt : 0);
+    float y0 = r.y + (e.Velocidad.y < 0 ? e.Velocidad.y * dt : 0);
+    float x1 = r.x + r.width + (e.Velocidad.x > 0 ? e.Velocidad.x * dt : 0);
+    float y1 = r.y + r.height + (e.Velocidad.y > 0 ? e.Velocidad.y * dt : 0);
+    Rectangle recorrido = { x0 - e.Ancho, y0 - e.Ancho, x1 - x0 + e.Ancho * 2, y1 - y0 + e.Ancho * 2 };
+
+    int candidatos[MaxContactos];
+    int numCandidatos = ConsultarMundo(mundo, recorrido, COL_SOLIDO | COL_UNA_VIA, candidatos, MaxContactos);
+
+    // --- MOVER EN X ---
+    e.Posicion.x += e.Velocidad.x * dt;
+    r = RectJugador(e);
+
+    // Colisión con sólidos (plataformas y cajas); lo de una vía no frena de costado.
+    // El rectángulo del jugador está recortado: se lo deja tocando el borde
+    // (no la posición del sprite, que es más ancha).
+    for (int k = 0; k < numCandidatos; k++)
+    {
+        int i = candidatos[k];
+        if (!(mundo.Etiquetas[i] & COL_SOLIDO)) continue;
+
+        const Rectangle& cr = mundo.Rects[i];
+        if (CheckCollisionRecs(r, cr))
+        {
+            float margen = r.x - e.Posicion.x;
+            if (e.Velocidad.x > 0) e.Posicion.x = cr.x - r.width - margen;
+            else if (e.Velocidad.x < 0) e.Posicion.x = cr.x + cr.width - margen;
+            r = RectJugador(e);
+        }
+    }
+
+    // --- MOVER EN Y ---
+    e.EnSuelo = false;
+    e.Apoyo = -1;
+    TipoSuelo nuevoTipo = SUELO_AIRE;
+
+    e.Posicion.y += e.Velocidad.y * dt;
+    r = RectJugador(e);
+
+    // En orden de carga: primero el suelo, después plataformas y cajas.
+    // Los pies se prueban ToleranciaApoyo más abajo: quien quedó parado
+    // justo sobre una superficie (tocándola, sin superponerse) sigue
+    // apoyado en el paso siguiente.
+    // - Sólido: se pisa si no se está subiendo.
+    // - Una vía: además los pies tenían que estar arriba al empezar el
+    //   tick (para lo que se mueve, arriba de donde estaba antes de moverse).
+    for (int k = 0; k < numCandidatos; k++)
+    {
+        int i = candidatos[k];
+        const Rectangle& cr = mundo.Rects[i];
+        Rectangle pies = { r.x, r.y, r.width, r.height + ToleranciaApoyo };
+        if (!CheckCollisionRecs(pies, cr)) continue;
+
+        bool pisa = e.Velocidad.y >= 0;
+        if (pisa && (mundo.Etiquetas[i] & COL_UNA_VIA))
+        {
+            float topeAntes = cr.y;
+            if (i >= mundo.NumEstaticos) topeAntes -= mundo.Desplazamientos[i - mundo.NumEstaticos].y;
+            pisa = pieAntes <= topeAntes + ToleranciaApoyo;
+        }
+
+        if (pisa)
+        {
+            e.EnSuelo = true;
+            e.Apoyo = (short)i;
+            nuevoTipo = (TipoSuelo)mundo.Datos[i];
+            e.Velocidad.y = 0;
+            e.Posicion.y = cr.y - e.Alto;
+        }
+        r = RectJugador(e);
+    }
+
+    e.TipoActual = nuevoTipo;
+
+    // --- Salto buffer ---
+    if (e.EnSuelo && e.BufferSalto > 0)
+    {
+        if (Saltar(e)) sucesos |= PASO_SALTO;
+        e.BufferSalto = 0;
+    }
+
+    // --- Pasos (el sonido lo decide Player) ---
+    if (e.EnSuelo && e.Moviendo)
+        sucesos |= PASO_CAMINANDO;
+
+    // --- Limites pantalla ---
+    if (e.Posicion.x < 0) e.Posicion.x = 0;
+    if (e.Posicion.x > 1024 - e.Ancho) e.Posicion.x = 1024 - e.Ancho;
+
+    return sucesos;
+}
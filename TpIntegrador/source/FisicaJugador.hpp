@@ -0,0 +1,69 @@
+﻿#pragma once
+#include "raylib.h"
+
+struct Nivel;       // Declaración anticipada (se define en Nivel.hpp)
+
+// ============================================================================
+// TIPO DE SUPERFICIE BAJO EL JUGADOR
+// ============================================================================
+// Permite saber si está pisando pasto, una caja o está en el aire.
+// Esto afecta sonidos y comportamiento de salto.
+// ============================================================================
+enum TipoSuelo { SUELO_PASTO, SUELO_CAJA, SUELO_AIRE };
+
+// ============================================================================
+// ENTRADA DE UN PASO DE FÍSICA
+// ============================================================================
+// Lo que el jugador quiere hacer en este paso, ya traducido desde el
+// teclado (o desde una grabación, un bot, etc.).
+// ============================================================================
+struct EntradaJugador
+{
+    bool Derecha;       // Mantiene D / flecha derecha
+    bool Izquierda;     // Mantiene A / flecha izquierda
+    bool Salto;         // Presionó ESPACIO en este paso
+};
+
+// ============================================================================
+// ESTADO FÍSICO DEL JUGADOR (DATOS "CALIENTES")
+// ============================================================================
+// Solo lo que toca el paso de física, empaquetado en un POD que entra en
+// una línea de caché. La textura, los sonidos y los temporizadores de
+// audio quedan en Player (datos "fríos").
+// ============================================================================
+struct EstadoJugador
+{
+    Vector2 Posicion;               // Posición actual
+    Vector2 Velocidad;              // Velocidad en X/Y
+    float Ancho;                    // Dimensiones base del sprite escalado
+    float Alto;
+    float BufferSalto;              // Permite "guardar" el salto por unos ms
+    int ContadorSaltos;             // Para perder si se pasa de 10
+    unsigned char EnSuelo;          // Distinto de 0 si está tocando alguna superficie
+    unsigned char TipoActual;       // TipoSuelo donde está parado actualmente
+    unsigned char MirandoDerecha;   // Para espejar el sprite
+    unsigned char Moviendo;         // Se movió en X durante el último paso
+    short Apoyo;                    // Colisionador del Mundo que pisa (-1 si ninguno)
+};
+
+static_assert(sizeof(EstadoJugador) <= 64, "EstadoJugador debe entrar en una linea de cache");
+
+// Sucesos que produjo un paso (para sonidos y demás efectos)
+enum SucesoPaso : unsigned char
+{
+    PASO_NINGUNO = 0,
+    PASO_SALTO = 1 << 0,        // Despegó del suelo en este paso
+    PASO_CAMINANDO = 1 << 1,    // Está en el suelo y moviéndose
+    PASO_PISADA = 1 << 2        // Toca sonar un paso (lo marca Player con TimerPaso)
+};
+
+// Estado inicial en la posición de aparición
+void IniciarEstadoJugador(EstadoJugador& e, float ancho, float alto);
+
+// Rectángulo de colisión (recortado horizontalmente para ajustar al sprite)
+Rectangle RectJugador(const EstadoJugador& e);
+
+// Avanza un paso: movimiento, gravedad, colisiones y salto.
+// Devuelve una combinación de SucesoPaso.
+unsigned char PasoFisicoJugador(EstadoJugador& e, const EntradaJugador& entrada,
+                                float dt, const Nivel& nivel);
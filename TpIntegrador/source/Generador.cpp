@@ -0,0 +1,437 @@
+﻿#include "Generador.hpp"
+#include "Player.hpp"
+#include "Puerta.hpp"
+#include "Plataforma.hpp"
+#include "Caja.hpp"
+#include "Enemigo.hpp"
+#include "Reglas.hpp"
+#include "Simulacion.hpp"
+#include "Instantanea.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+// ============================================================================
+// AZAR REPRODUCIBLE (mismo generador que los niveles sintéticos del benchmark)
+// ============================================================================
+static unsigned int SiguienteAleatorio(unsigned int& estado)
+{
+    estado = estado * 1664525u + 1013904223u;
+    return estado >> 8;
+}
+
+static int Entre(unsigned int& estado, int minimo, int maximo)
+{
+    return minimo + (int)(SiguienteAleatorio(estado) % (unsigned int)(maximo - minimo + 1));
+}
+
+// ============================================================================
+// GEOMETRÍA FIJA
+// ============================================================================
+// La puerta no se mueve (Puerta::Puerta): está parada sobre la plataforma
+// de la puerta, la misma del nivel 1. El jugador aparece abajo a la izquierda.
+static const Vector2 PlataformaPuerta = { 285, 300 };
+static const Rectangle ZonaAparicion = { 0, 500, 140, 140 };
+static const float AnchoPantalla = 1024.0f;
+static const float AltoSuelo = 640.0f;
+static const int ColumnasTerreno = 18;
+
+static Rectangle Agrandar(Rectangle r, float margen)
+{
+    return { r.x - margen, r.y - margen, r.width + margen * 2, r.height + margen * 2 };
+}
+
+// true si la plataforma en 'p' no pisa a las otras, a la puerta ni a la aparición
+static bool LugarLibre(const NivelGenerado& n, Vector2 p)
+{
+    Rectangle r = Agrandar(Plataforma(p.x, p.y).GetRect(), 20);
+    if (r.x < 0 || r.x + r.width > AnchoPantalla + 40) return false;
+    if (CheckCollisionRecs(r, ZonaAparicion)) return false;
+
+    // Lo que está sobre la plataforma de la puerta queda libre
+    Rectangle sobrePuerta = Plataforma(PlataformaPuerta.x, PlataformaPuerta.y).GetRect();
+    sobrePuerta.y -= 110;
+    sobrePuerta.height += 110;
+    if (CheckCollisionRecs(r, sobrePuerta)) return false;
+
+    for (const Vector2& o : n.Plataformas)
+        if (CheckCollisionRecs(r, Plataforma(o.x, o.y).GetRect())) return false;
+    return true;
+}
+
+// ============================================================================
+// GENERACIÓN
+// ============================================================================
+// Una escalera de 3 a 5 plataformas desde el suelo hasta la altura de la
+// puerta (cada escalón al alcance de un salto: sube 112 px y avanza unos
+// 200), la plataforma de la puerta, algunas plataformas sueltas, cajas sobre
+// los escalones, murciélagos y el terreno con tramos de pinchos. Lo que no
+// se puede jugar lo descarta la verificación.
+void GenerarNivel(unsigned int semilla, int id, NivelGenerado& n)
+{
+    n = {};
+    n.Id = id;
+    n.Semilla = semilla;
+    unsigned int s = semilla;
+
+    // --- Escalera hasta la altura de la puerta ---
+    int escalones = Entre(s, 3, 5);
+    float x = 60;
+    float anchoPlataforma = Plataforma(0, 0).GetRect().width;
+    for (int i = 1; i <= escalones; i++)
+    {
+        float y = AltoSuelo - (AltoSuelo - PlataformaPuerta.y) * i / (escalones + 1) + Entre(s, -10, 10);
+
+        // El último escalón queda al costado de la plataforma de la puerta
+        for (int intento = 0; intento < 8; intento++)
+        {
+            float nx;
+            if (i == escalones)
+                nx = PlataformaPuerta.x + (Entre(s, 0, 1) ? 1 : -1) * (float)Entre(s, 200, 320);
+            else
+                nx = x + (Entre(s, 0, 2) > 0 ? 1 : -1) * (float)Entre(s, 140, 300);
+
+            nx = std::min(std::max(nx, 0.0f), AnchoPantalla - anchoPlataforma);
+            if (LugarLibre(n, { nx, y }))
+            {
+                n.Plataformas.push_back({ nx, y });
+                x = nx;
+                break;
+            }
+        }
+    }
+
+    n.Plataformas.push_back(PlataformaPuerta);
+
+    // --- Plataformas sueltas ---
+    int sueltas = Entre(s, 0, 2);
+    for (int i = 0; i < sueltas; i++)
+    {
+        Vector2 p = { (float)Entre(s, 0, (int)(AnchoPantalla - anchoPlataforma)), (float)Entre(s, 180, 560) };
+        if (LugarLibre(n, p)) n.Plataformas.push_back(p);
+    }
+
+    // --- Cajas sobre los escalones (nunca sobre la plataforma de la puerta) ---
+    int escalera = (int)n.Plataformas.size() - 1 - sueltas;
+    float altoCaja = Caja(0, 0).GetRect().height;
+    int cajas = escalera > 0 ? Entre(s, 0, 2) : 0;
+    for (int i = 0; i < cajas; i++)
+    {
+        const Vector2& p = n.Plataformas[Entre(s, 0, escalera - 1)];
+        n.Cajas.push_back({ p.x + (float)Entre(s, 0, 120), p.y - altoCaja });
+    }
+
+    // --- Murciélagos (lejos del lugar de aparición) ---
+    float anchoMurcielago = Enemigo(0, 0, 0, 0).GetRect().width;
+    int murcielagos = Entre(s, 1, 4);
+    for (int i = 0; i < murcielagos; i++)
+    {
+        float mx = (float)Entre(s, 150, 850);
+        float my = (float)Entre(s, 150, 560);
+        float rango = (float)Entre(s, 60, 160);
+        float minX = std::max(mx - rango, 150.0f);
+        float maxX = std::min(mx + rango, AnchoPantalla - anchoMurcielago);
+        n.Enemigos.push_back({ mx, my, minX, maxX });
+    }
+
+    // --- Terreno: suelo al principio y tramos de pinchos y suelo ---
+    n.Tiles.resize(ColumnasTerreno);
+    int c = Entre(s, 3, 6);
+    for (int i = 0; i < c; i++) n.Tiles[i] = TILE_SUELO;
+    bool pinchos = true;
+    while (c < ColumnasTerreno)
+    {
+        int largo = pinchos ? Entre(s, 2, 5) : Entre(s, 1, 3);
+        for (; largo > 0 && c < ColumnasTerreno; largo--, c++)
+            n.Tiles[c] = (unsigned char)(pinchos ? TILE_PINCHOS : TILE_SUELO);
+        pinchos = !pinchos;
+    }
+}
+
+DisenoNivel NivelGenerado::Diseno() const
+{
+    DisenoNivel d = {};
+    d.Nombre = "Desafio";
+    d.Plataformas = Plataformas.data();
+    d.NumPlataformas = (int)Plataformas.size();
+    d.Cajas = Cajas.data();
+    d.NumCajas = (int)Cajas.size();
+    d.Enemigos = Enemigos.data();
+    d.NumEnemigos = (int)Enemigos.size();
+    d.Tiles = Tiles.data();
+    d.ColumnasTiles = (int)Tiles.size();
+    d.FilasTiles = 1;
+    return d;
+}
+
+// ============================================================================
+// VERIFICACIÓN
+// ============================================================================
+static const unsigned short Acciones[6] = {
+    0, ENT_DERECHA, ENT_IZQUIERDA,
+    ENT_SALTO, ENT_SALTO | ENT_DERECHA, ENT_SALTO | ENT_IZQUIERDA
+};
+
+static const int MaxFrente = 192;       // Estados por tramo (se quedan los más cerca de la puerta)
+static const int MaxNodos = 60000;      // Presupuesto de la búsqueda
+
+struct PasoBusqueda
+{
+    int Padre;
+    unsigned char Accion;
+};
+
+// Celda del jugador: posición de a 10 px, si está apoyado y si sube o cae
+static unsigned int ClaveEstado(const EstadoJugador& e)
+{
+    int cx = std::min(std::max((int)(e.Posicion.x / 10), 0), 255);
+    int cy = std::min(std::max((int)(e.Posicion.y / 10), 0), 255);
+    int vy = e.EnSuelo ? 0 : e.Velocidad.y < 0 ? 1 : 2;
+    return (unsigned int)(cx | cy << 8 | vy << 16);
+}
+
+static EntradaFrame EntradaAccion(unsigned char accion, int tick, Vector2 puerta)
+{
+    unsigned short botones = Acciones[accion];
+    if (tick > 0) botones &= (unsigned short)~ENT_SALTO;     // El salto es un pulso
+    return { DtTick, puerta, (unsigned short)(botones | ENT_CLICK), 0 };
+}
+
+Verificacion VerificarNivel(const NivelGenerado& n, ArenaNivel& arena, std::vector<EntradaFrame>* solucion)
+{
+    Verificacion v = {};
+
+    Nivel nivel;
+    if (!ConstruirNivel(n.Id, n.Diseno(), arena, nivel)) return v;
+
+    Player jugador;
+    Puerta puerta;
+    float tiempo = 0;
+    Rectangle rp = puerta.GetRect();
+    Vector2 centroPuerta = { rp.x + rp.width / 2, rp.y + rp.height / 2 };
+
+    std::vector<InstantaneaPartida> frente(1), siguiente;
+    std::vector<int> idFrente(1, 0), idSiguiente;
+    std::vector<PasoBusqueda> pasos(1, { -1, 0 });
+    std::unordered_map<unsigned int, int> menosSaltos;
+    frente.reserve(MaxFrente * 6);
+    siguiente.reserve(MaxFrente * 6);
+
+    if (!TomarInstantanea(frente[0], nivel, jugador, puerta, tiempo))
+    {
+        TraceLog(LOG_WARNING, "GENERADOR: el nivel %i no entra en una instantánea (%i murciélagos, %i plataformas móviles), se descarta",
+                 n.Id, nivel.NumEnemigos, nivel.NumPlataformasMoviles);
+        DescargarNivel(nivel, arena);
+        return v;
+    }
+
+    int ganador = -1;
+    int ticksGanador = 0;
+    const int tramosMax = (int)(TiempoLimite / DtTick) / TicksAccion + 1;
+
+    for (int tramo = 0; tramo < tramosMax && ganador < 0 && !frente.empty(); tramo++)
+    {
+        siguiente.clear();
+        idSiguiente.clear();
+
+        for (size_t f = 0; f < frente.size() && ganador < 0; f++)
+        {
+            for (unsigned char a = 0; a < 6 && ganador < 0; a++)
+            {
+                RestaurarInstantanea(frente[f], nivel, jugador, puerta, tiempo);
+                v.Nodos++;
+
+                bool vivo = true;
+                for (int t = 0; t < TicksAccion; t++)
+                {
+                    ResultadoTick r = SimularTick(nivel, jugador, puerta, tiempo, EntradaAccion(a, t, centroPuerta));
+                    if (r.Victoria)
+                    {
+                        pasos.push_back({ idFrente[f], a });
+                        ganador = (int)pasos.size() - 1;
+                        ticksGanador = tramo * TicksAccion + t + 1;
+                        break;
+                    }
+                    if (r.Derrota != SIN_PERDIDA)
+                    {
+                        vivo = false;
+                        break;
+                    }
+                }
+                if (!vivo || ganador >= 0) continue;
+
+                // Misma celda con igual o menos saltos: no aporta nada nuevo
+                unsigned int clave = ClaveEstado(jugador.Fisica);
+                auto it = menosSaltos.find(clave);
+                if (it != menosSaltos.end() && it->second <= jugador.Fisica.ContadorSaltos) continue;
+                menosSaltos[clave] = jugador.Fisica.ContadorSaltos;
+
+                siguiente.emplace_back();
+                TomarInstantanea(siguiente.back(), nivel, jugador, puerta, tiempo);
+                pasos.push_back({ idFrente[f], a });
+                idSiguiente.push_back((int)pasos.size() - 1);
+            }
+        }
+
+        // Demasiados estados: siguen los que quedaron más cerca de la puerta
+        if ((int)siguiente.size() > MaxFrente)
+        {
+            std::vector<int> orden(siguiente.size());
+            for (size_t i = 0; i < orden.size(); i++) orden[i] = (int)i;
+            auto distancia = [&](int i) {
+                Vector2 p = siguiente[i].Jugador.Posicion;
+                return (p.x - centroPuerta.x) * (p.x - centroPuerta.x) + (p.y - centroPuerta.y) * (p.y - centroPuerta.y);
+            };
+            std::nth_element(orden.begin(), orden.begin() + MaxFrente, orden.end(),
+                [&](int a, int b) { return distancia(a) < distancia(b); });
+
+            frente.resize(MaxFrente);
+            idFrente.resize(MaxFrente);
+            for (int i = 0; i < MaxFrente; i++)
+            {
+                frente[i] = siguiente[orden[i]];
+                idFrente[i] = idSiguiente[orden[i]];
+            }
+        }
+        else
+        {
+            std::swap(frente, siguiente);
+            std::swap(idFrente, idSiguiente);
+        }
+
+        if (v.Nodos >= MaxNodos) break;
+    }
+
+    if (ganador >= 0)
+    {
+        // Entrada tick a tick de la partida encontrada
+        std::vector<unsigned char> acciones;
+        for (int p = ganador; pasos[p].Padre >= 0; p = pasos[p].Padre)
+            acciones.push_back(pasos[p].Accion);
+        std::reverse(acciones.begin(), acciones.end());
+
+        std::vector<EntradaFrame> entradas;
+        entradas.reserve(acciones.size() * TicksAccion);
+        for (unsigned char a : acciones)
+            for (int t = 0; t < TicksAccion; t++) entradas.push_back(EntradaAccion(a, t, centroPuerta));
+        entradas.resize(ticksGanador);
+
+        // Desde cero, con la misma simulación que el juego: tiene que ganar
+        Player limpio;
+        Puerta puertaLimpia;
+        float tiempoLimpio = 0;
+        ReiniciarNivel(nivel);
+        int ticks = Resimular(nivel, limpio, puertaLimpia, tiempoLimpio, entradas.data(), (int)entradas.size());
+
+        v.Resoluble = puertaLimpia.EstaAbierta && ticks == ticksGanador &&
+                      ComprobarDerrota(limpio.Fisica, nivel, tiempoLimpio) == SIN_PERDIDA;
+        v.Ticks = ticks;
+        v.Saltos = limpio.Fisica.ContadorSaltos;
+        if (v.Resoluble && solucion) *solucion = std::move(entradas);
+    }
+
+    DescargarNivel(nivel, arena);
+    return v;
+}
+
+// ============================================================================
+// ARCHIVO DE NIVELES
+// ============================================================================
+static const int VersionNiveles = 1;
+
+static char LetraTile(unsigned char t)
+{
+    return t == TILE_SUELO ? 'S' : t == TILE_PINCHOS ? 'P' : '.';
+}
+
+static unsigned char TileLetra(char c)
+{
+    return (unsigned char)(c == 'S' ? TILE_SUELO : c == 'P' ? TILE_PINCHOS : TILE_VACIO);
+}
+
+bool GuardarNiveles(const char* ruta, const std::vector<NivelGenerado>& niveles)
+{
+    FILE* f = std::fopen(ruta, "w");
+    if (!f) return false;
+
+    std::fprintf(f, "TPNV %d\n", VersionNiveles);
+    for (const NivelGenerado& n : niveles)
+    {
+        std::fprintf(f, "nivel %d semilla %u par %d saltos %d\n", n.Id, n.Semilla, n.TicksPar, n.SaltosPar);
+
+        std::fprintf(f, "plataformas %d", (int)n.Plataformas.size());
+        for (const Vector2& p : n.Plataformas) std::fprintf(f, " %g %g", p.x, p.y);
+
+        std::fprintf(f, "\ncajas %d", (int)n.Cajas.size());
+        for (const Vector2& c : n.Cajas) std::fprintf(f, " %g %g", c.x, c.y);
+
+        std::fprintf(f, "\nmurcielagos %d", (int)n.Enemigos.size());
+        for (const SpawnEnemigo& e : n.Enemigos) std::fprintf(f, " %g %g %g %g", e.X, e.Y, e.MinX, e.MaxX);
+
+        std::fprintf(f, "\nterreno %d ", (int)n.Tiles.size());
+        for (unsigned char t : n.Tiles) std::fputc(LetraTile(t), f);
+        std::fprintf(f, "\nfin\n");
+    }
+
+    bool ok = !std::ferror(f);
+    std::fclose(f);
+    return ok;
+}
+
+// Lee "<nombre> <n>" y después n grupos de 'valores' floats
+static bool LeerTabla(FILE* f, const char* nombre, int valores, std::vector<float>& datos)
+{
+    char palabra[16];
+    int cantidad = 0;
+    if (std::fscanf(f, "%15s %d", palabra, &cantidad) != 2 || std::strcmp(palabra, nombre) != 0 ||
+        cantidad < 0 || cantidad > 4096)
+        return false;
+
+    datos.resize((size_t)cantidad * valores);
+    for (float& d : datos)
+        if (std::fscanf(f, "%f", &d) != 1) return false;
+    return true;
+}
+
+bool CargarNiveles(const char* ruta, std::vector<NivelGenerado>& niveles)
+{
+    niveles.clear();
+
+    FILE* f = std::fopen(ruta, "r");
+    if (!f) return false;
+
+    int version = 0;
+    bool ok = std::fscanf(f, "TPNV %d", &version) == 1 && version == VersionNiveles;
+
+    std::vector<float> datos;
+    char terreno[256];
+    NivelGenerado n;
+    while (ok && std::fscanf(f, " nivel %d semilla %u par %d saltos %d", &n.Id, &n.Semilla, &n.TicksPar, &n.SaltosPar) == 4)
+    {
+        ok = LeerTabla(f, "plataformas", 2, datos);
+        n.Plataformas.clear();
+        for (size_t i = 0; ok && i < datos.size(); i += 2) n.Plataformas.push_back({ datos[i], datos[i + 1] });
+
+        ok = ok && LeerTabla(f, "cajas", 2, datos);
+        n.Cajas.clear();
+        for (size_t i = 0; ok && i < datos.size(); i += 2) n.Cajas.push_back({ datos[i], datos[i + 1] });
+
+        ok = ok && LeerTabla(f, "murcielagos", 4, datos);
+        n.Enemigos.clear();
+        for (size_t i = 0; ok && i < datos.size(); i += 4)
+            n.Enemigos.push_back({ datos[i], datos[i + 1], datos[i + 2], datos[i + 3] });
+
+        int columnas = 0;
+        ok = ok && std::fscanf(f, " terreno %d %255s fin", &columnas, terreno) == 2 &&
+             columnas == (int)std::strlen(terreno);
+        n.Tiles.clear();
+        for (int i = 0; ok && i < columnas; i++) n.Tiles.push_back(TileLetra(terreno[i]));
+
+        if (ok) niveles.push_back(n);
+    }
+
+    std::fclose(f);
+    if (!ok) TraceLog(LOG_WARNING, "GENERADOR: %s no es un archivo de niveles válido", ruta);
+    return ok;
+}
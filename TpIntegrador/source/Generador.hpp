@@ -0,0 +1,79 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Arena.hpp"
+#include "Nivel.hpp"
+#include "Entrada.hpp"
+#include <vector>
+
+// ============================================================================
+// NIVEL GENERADO
+// ============================================================================
+// Un nivel armado por el generador con el mismo vocabulario que el nivel 1:
+// plataformas, cajas, murciélagos, una fila de terreno (suelo y pinchos) y
+// la puerta en su lugar de siempre, sobre la plataforma de la puerta.
+// Dueño de sus tablas; Diseno() las presenta como un DisenoNivel para
+// ConstruirNivel() (los punteros valen mientras el NivelGenerado no cambie).
+// ============================================================================
+struct NivelGenerado
+{
+    int Id;
+    unsigned int Semilla;
+
+    std::vector<Vector2> Plataformas;
+    std::vector<Vector2> Cajas;
+    std::vector<SpawnEnemigo> Enemigos;
+    std::vector<unsigned char> Tiles;   // Una fila (IdTile)
+
+    // Lo que encontró el verificador: la partida ganadora más corta que vio
+    int TicksPar;
+    int SaltosPar;
+
+    DisenoNivel Diseno() const;
+};
+
+// Arma el nivel de 'semilla' (misma semilla, mismo nivel). No lo verifica.
+void GenerarNivel(unsigned int semilla, int id, NivelGenerado& n);
+
+// ============================================================================
+// VERIFICACIÓN CON LA FÍSICA DEL JUEGO
+// ============================================================================
+// Busca una partida ganadora con SimularTick (la misma física, murciélagos,
+// pinchos y reglas de 10 saltos y 20 segundos que el juego): búsqueda a lo
+// ancho por tramos de TicksAccion ticks, con seis acciones por tramo
+// (quieto / derecha / izquierda, con o sin salto) y el click siempre sobre
+// la puerta. Los estados se guardan como InstantaneaPartida; dos estados
+// con el jugador en la misma celda (y el mismo apoyo y sentido vertical)
+// se juntan, quedándose con el de menos saltos.
+//
+// La búsqueda puede descartar niveles que un jugador sí resolvería (las
+// celdas juntan estados distintos), pero nunca acepta uno imposible: la
+// partida encontrada se vuelve a simular desde cero y tiene que ganar.
+// ============================================================================
+const int TicksAccion = 6;
+
+struct Verificacion
+{
+    bool Resoluble;
+    int Ticks;                  // Ticks hasta abrir la puerta
+    int Saltos;
+    int Nodos;                  // Estados expandidos
+};
+
+// 'arena' es de quien llama (un hilo, una arena). Si 'solucion' no es
+// nullptr, recibe la entrada de cada tick de la partida ganadora.
+Verificacion VerificarNivel(const NivelGenerado& n, ArenaNivel& arena,
+                            std::vector<EntradaFrame>* solucion = nullptr);
+
+// ============================================================================
+// ARCHIVO DE NIVELES (texto, uno detrás del otro)
+// ============================================================================
+//   TPNV 1
+//   nivel <id> semilla <semilla> par <ticks> saltos <saltos>
+//   plataformas <n> x y x y ...
+//   cajas <n> x y ...
+//   murcielagos <n> x y minX maxX ...
+//   terreno <columnas> SSSSSPPPP...      (S suelo, P pinchos, . vacío)
+//   fin
+// ============================================================================
+bool GuardarNiveles(const char* ruta, const std::vector<NivelGenerado>& niveles);
+bool CargarNiveles(const char* ruta, std::vector<NivelGenerado>& niveles);
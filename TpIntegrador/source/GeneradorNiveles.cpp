@@ -0,0 +1,138 @@
+﻿#include "raylib.h"         // Solo LoadImage y TraceLog: no se abre ventana
+#include "Recursos.hpp"     // Dimensiones de los sprites (sin GPU)
+#include "Arena.hpp"        // Una arena por hilo para construir y verificar
+#include "Generador.hpp"    // Generación, verificación y archivo de niveles
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// GENERADOR DE NIVELES DEL DESAFÍO DIARIO
+// ============================================================================
+// Genera niveles a partir de una semilla, verifica cada uno con la física
+// del juego (VerificarNivel) y guarda en un archivo de texto los que se
+// pueden ganar, con su par (ticks y saltos de la partida encontrada).
+//
+// Los hilos toman semillas de un contador compartido y cada uno usa su
+// propia arena, su jugador y su puerta: no comparten nada que se escriba.
+// El nivel i usa siempre la semilla (semilla base, i), así el archivo sale
+// igual con cualquier cantidad de hilos.
+//
+// Uso:
+//   GeneradorNiveles [--cantidad 1000] [--semilla 1] [--hilos 0]
+//                    [--salida Niveles.tpnv] [--id-inicial 1000]
+//
+// --cantidad son los niveles válidos pedidos; --hilos 0 usa todos los
+// núcleos. Termina con código 1 si no llegó a la cantidad pedida.
+// ============================================================================
+
+// Semilla del intento i (mezcla de bits: semillas vecinas, niveles distintos)
+static unsigned int SemillaIntento(unsigned int base, unsigned int i)
+{
+    unsigned int h = base * 0x9E3779B9u ^ i * 0x85EBCA6Bu;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    return h;
+}
+
+struct Intento
+{
+    NivelGenerado Nivel;
+    Verificacion Resultado;
+};
+
+int main(int argc, char** argv)
+{
+    int cantidad = 1000;
+    unsigned int semilla = 1;
+    int hilos = 0;
+    int idInicial = 1000;
+    const char* rutaSalida = "Niveles.tpnv";
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "--cantidad") && i + 1 < argc) cantidad = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--semilla") && i + 1 < argc) semilla = (unsigned int)std::strtoul(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--hilos") && i + 1 < argc) hilos = std::atoi(argv[++i]);
+        else if (!std::strcmp(argv[i], "--salida") && i + 1 < argc) rutaSalida = argv[++i];
+        else if (!std::strcmp(argv[i], "--id-inicial") && i + 1 < argc) idInicial = std::atoi(argv[++i]);
+    }
+
+    if (hilos <= 0) hilos = (int)std::thread::hardware_concurrency();
+    if (hilos <= 0) hilos = 1;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // Solo dimensiones de los sprites: no hay ventana ni GPU
+    Recursos::CargarSinVentana();
+
+    // Se prueba de a tandas hasta juntar 'cantidad' válidos; dentro de una
+    // tanda los hilos reparten los intentos con un contador atómico
+    const int intentosPorTanda = cantidad * 4 > 256 ? cantidad * 4 : 256;
+    const int maxTandas = 16;
+
+    std::vector<NivelGenerado> validos;
+    validos.reserve(cantidad);
+    long long intentosTotales = 0;
+    long long resolubles = 0;
+    long long nodosTotales = 0;
+
+    auto inicio = std::chrono::steady_clock::now();
+
+    for (int tanda = 0; tanda < maxTandas && (int)validos.size() < cantidad; tanda++)
+    {
+        std::vector<Intento> intentos(intentosPorTanda);
+        std::atomic<int> proximo{ 0 };
+        unsigned int primero = (unsigned int)(tanda * intentosPorTanda);
+
+        auto trabajar = [&]() {
+            ArenaNivel arena(64 * 1024);
+            for (int i = proximo.fetch_add(1); i < intentosPorTanda; i = proximo.fetch_add(1))
+            {
+                Intento& it = intentos[i];
+                GenerarNivel(SemillaIntento(semilla, primero + i), 0, it.Nivel);
+                it.Resultado = VerificarNivel(it.Nivel, arena);
+            }
+        };
+
+        std::vector<std::thread> trabajadores;
+        for (int h = 1; h < hilos; h++) trabajadores.emplace_back(trabajar);
+        trabajar();
+        for (std::thread& t : trabajadores) t.join();
+
+        // En el orden de los intentos (no en el que terminaron los hilos)
+        for (Intento& it : intentos)
+        {
+            nodosTotales += it.Resultado.Nodos;
+            if (!it.Resultado.Resoluble) continue;
+            resolubles++;
+            if ((int)validos.size() >= cantidad) continue;
+
+            it.Nivel.Id = idInicial + (int)validos.size();
+            it.Nivel.TicksPar = it.Resultado.Ticks;
+            it.Nivel.SaltosPar = it.Resultado.Saltos;
+            validos.push_back(std::move(it.Nivel));
+        }
+        intentosTotales += intentosPorTanda;
+    }
+
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    std::printf("Niveles validos: %d (resolubles %lld de %lld intentos, %.1f%%) con %d hilos\n",
+        (int)validos.size(), resolubles, intentosTotales, 100.0 * resolubles / intentosTotales, hilos);
+    std::printf("Tiempo: %.2f s -> %.0f niveles resolubles por minuto, %.0f estados por intento\n",
+        segundos, resolubles * 60.0 / segundos, (double)nodosTotales / intentosTotales);
+
+    if (!GuardarNiveles(rutaSalida, validos))
+    {
+        std::fprintf(stderr, "No se pudo escribir %s\n", rutaSalida);
+        return 2;
+    }
+
+    return (int)validos.size() < cantidad ? 1 : 0;
+}
@@ -0,0 +1,314 @@
+﻿#include "Historial.hpp"
+#include "raylib.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+// ============================================================================
+// SUMA DE CONTROL (FNV-1a)
+// ============================================================================
+unsigned int SumaRegistro(const RegistroCarrera& r)
+{
+    const unsigned char* p = (const unsigned char*)&r;
+    unsigned int h = 2166136261u;
+    for (size_t i = 0; i < offsetof(RegistroCarrera, Suma); i++)
+    {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// ============================================================================
+// ÍNDICE
+// ============================================================================
+static int CubetaDe(float tiempo)
+{
+    int c = (int)(tiempo * 100.0f);
+    if (c < 0) c = 0;
+    if (c >= CubetasTiempo) c = CubetasTiempo - 1;
+    return c;
+}
+
+static IndiceNivel& NivelDelIndice(IndiceCarreras& indice, int idNivel)
+{
+    for (IndiceNivel& n : indice.Niveles)
+        if (n.IdNivel == idNivel) return n;
+
+    indice.Niveles.push_back({});
+    IndiceNivel& n = indice.Niveles.back();
+    n.IdNivel = idNivel;
+    n.Arbol.assign(CubetasTiempo + 1, 0);
+    return n;
+}
+
+void AgregarAlIndice(IndiceCarreras& indice, const RegistroCarrera& r)
+{
+    IndiceNivel& n = NivelDelIndice(indice, r.IdNivel);
+    n.Carreras++;
+    if (r.Motivo <= PERDIDA_PINCHOS) n.PorMotivo[r.Motivo]++;
+    if (r.Motivo != SIN_PERDIDA) return;
+
+    n.Ganadas++;
+    if (n.Mejor == 0 || r.Tiempo < n.Mejor) n.Mejor = r.Tiempo;
+
+    for (int i = CubetaDe(r.Tiempo) + 1; i <= CubetasTiempo; i += i & -i)
+        n.Arbol[i]++;
+}
+
+void SumarIndice(IndiceCarreras& indice, const IndiceCarreras& otro)
+{
+    for (const IndiceNivel& o : otro.Niveles)
+    {
+        IndiceNivel& n = NivelDelIndice(indice, o.IdNivel);
+        n.Carreras += o.Carreras;
+        n.Ganadas += o.Ganadas;
+        for (int m = 0; m <= PERDIDA_PINCHOS; m++) n.PorMotivo[m] += o.PorMotivo[m];
+        if (o.Mejor > 0 && (n.Mejor == 0 || o.Mejor < n.Mejor)) n.Mejor = o.Mejor;
+
+        // Cada nodo del árbol es una suma de cubetas: se suman igual
+        for (int i = 1; i <= CubetasTiempo; i++) n.Arbol[i] += o.Arbol[i];
+    }
+}
+
+const IndiceNivel* BuscarNivel(const IndiceCarreras& indice, int idNivel)
+{
+    for (const IndiceNivel& n : indice.Niveles)
+        if (n.IdNivel == idNivel) return &n;
+    return nullptr;
+}
+
+int PuestoEnNivel(const IndiceNivel& nivel, float tiempo)
+{
+    // Ganadas en cubetas anteriores (estrictamente más rápidas)
+    int mejores = 0;
+    for (int i = CubetaDe(tiempo); i > 0; i -= i & -i)
+        mejores += nivel.Arbol[i];
+    return mejores + 1;
+}
+
+// ============================================================================
+// COLA HILO PRINCIPAL -> HILO DE ESCRITURA (sin locks, como la de Audio)
+// ============================================================================
+static const unsigned int CapacidadCola = 256;     // Potencia de 2
+
+static RegistroCarrera Cola[CapacidadCola];
+static std::atomic<unsigned int> Cabeza{ 0 };
+static std::atomic<unsigned int> Final{ 0 };
+static std::atomic<unsigned int> Descartados{ 0 };
+
+static bool Encolar(const RegistroCarrera& r)
+{
+    unsigned int cabeza = Cabeza.load(std::memory_order_relaxed);
+
+    if (cabeza - Final.load(std::memory_order_acquire) >= CapacidadCola)
+    {
+        Descartados.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Cola[cabeza & (CapacidadCola - 1)] = r;
+    Cabeza.store(cabeza + 1, std::memory_order_release);
+    return true;
+}
+
+static bool Desencolar(RegistroCarrera& r)
+{
+    unsigned int final = Final.load(std::memory_order_relaxed);
+
+    if (final == Cabeza.load(std::memory_order_acquire)) return false;
+
+    r = Cola[final & (CapacidadCola - 1)];
+    Final.store(final + 1, std::memory_order_release);
+    return true;
+}
+
+// ============================================================================
+// ESTADO
+// ============================================================================
+struct EncabezadoHistorial
+{
+    char Firma[4];              // "TPRC"
+    unsigned int Version;
+};
+
+static const unsigned int VersionHistorial = 1;
+
+// Entre una escritura y la siguiente se juntan los registros de este lapso
+static const std::chrono::milliseconds PausaEscritura(250);
+
+static std::thread HiloHistorial;
+static std::atomic<bool> Activo{ false };
+static const char* Ruta = nullptr;
+
+// Lo cargado del archivo: lo arma el hilo y, una vez publicado con
+// 'Cargado', lo suma el hilo principal a su índice (y no se vuelve a tocar)
+static IndiceCarreras IndiceArchivo;
+static std::atomic<bool> Cargado{ false };
+
+// Solo del hilo principal
+static IndiceCarreras Indice;
+static bool Adoptado = false;
+
+// ============================================================================
+// HILO DE ESCRITURA
+// ============================================================================
+// Lee los registros válidos y devuelve dónde termina el último (ahí sigue
+// la escritura, pisando un registro cortado si lo hay). -1 si el archivo
+// existe pero no es un historial.
+static long CargarArchivo(FILE* f, IndiceCarreras& indice, int& leidos)
+{
+    leidos = 0;
+
+    EncabezadoHistorial enc;
+    if (std::fread(&enc, sizeof(enc), 1, f) != 1) return 0;     // Vacío: se escribe el encabezado
+    if (std::memcmp(enc.Firma, "TPRC", 4) != 0 || enc.Version != VersionHistorial) return -1;
+
+    // En tandas: cientos de miles de carreras son unos pocos MB
+    static RegistroCarrera tanda[4096];
+    size_t n;
+    while ((n = std::fread(tanda, sizeof(RegistroCarrera), 4096, f)) > 0)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            if (tanda[i].Suma != SumaRegistro(tanda[i]))
+                return (long)(sizeof(enc) + leidos * sizeof(RegistroCarrera));
+            AgregarAlIndice(indice, tanda[i]);
+            leidos++;
+        }
+    }
+
+    return (long)(sizeof(enc) + leidos * sizeof(RegistroCarrera));
+}
+
+static void BucleHistorial()
+{
+    // --- Carga ---
+    FILE* f = std::fopen(Ruta, "r+b");
+    if (!f) f = std::fopen(Ruta, "w+b");
+
+    int leidos = 0;
+    long fin = f ? CargarArchivo(f, IndiceArchivo, leidos) : -1;
+
+    if (fin < 0)
+    {
+        TraceLog(LOG_WARNING, "HISTORIAL: no se pudo usar %s (no se guardan carreras)", Ruta);
+        if (f) std::fclose(f);
+        f = nullptr;
+    }
+    else if (fin == 0)
+    {
+        EncabezadoHistorial enc = { { 'T', 'P', 'R', 'C' }, VersionHistorial };
+        std::fseek(f, 0, SEEK_SET);
+        std::fwrite(&enc, sizeof(enc), 1, f);
+        std::fflush(f);
+    }
+    else
+    {
+        std::fseek(f, fin, SEEK_SET);
+    }
+
+    Cargado.store(true, std::memory_order_release);
+
+    // --- Escritura en tandas ---
+    RegistroCarrera tanda[CapacidadCola];
+    for (;;)
+    {
+        bool seguir = Activo.load(std::memory_order_acquire);
+
+        int n = 0;
+        while (n < (int)CapacidadCola && Desencolar(tanda[n])) n++;
+
+        if (n > 0 && f)
+        {
+            std::fwrite(tanda, sizeof(RegistroCarrera), n, f);
+            std::fflush(f);
+        }
+
+        if (!seguir && n == 0) break;     // Lo pendiente ya quedó escrito
+        if (seguir) std::this_thread::sleep_for(PausaEscritura);
+    }
+
+    if (f) std::fclose(f);
+}
+
+// Junta lo cargado con lo registrado mientras tanto (una sola vez)
+static void AdoptarCarga()
+{
+    if (Adoptado || !Cargado.load(std::memory_order_acquire)) return;
+
+    SumarIndice(Indice, IndiceArchivo);
+    IndiceArchivo = {};
+    Adoptado = true;
+}
+
+// ============================================================================
+// INTERFAZ PÚBLICA (hilo principal)
+// ============================================================================
+void Historial::Iniciar(const char* ruta)
+{
+    Ruta = ruta;
+    Indice = {};
+    IndiceArchivo = {};
+    Adoptado = false;
+    Cargado.store(false, std::memory_order_release);
+
+    Activo.store(true, std::memory_order_release);
+    HiloHistorial = std::thread(BucleHistorial);
+}
+
+void Historial::Detener()
+{
+    if (!HiloHistorial.joinable()) return;
+
+    Activo.store(false, std::memory_order_release);
+    HiloHistorial.join();
+
+    if (Descartados.load() > 0)
+        TraceLog(LOG_WARNING, "HISTORIAL: %u carreras descartadas por cola llena", Descartados.load());
+}
+
+void Historial::Registrar(int idNivel, float tiempo, MotivoPerdida motivo, int saltos)
+{
+    if (!Activo.load(std::memory_order_relaxed)) return;
+
+    RegistroCarrera r = {};
+    r.Fecha = (long long)std::time(nullptr);
+    r.Tiempo = tiempo;
+    r.IdNivel = idNivel;
+    r.Motivo = (unsigned char)motivo;
+    r.Saltos = (unsigned char)(saltos < 255 ? saltos : 255);
+    r.Suma = SumaRegistro(r);
+
+    Encolar(r);
+    AgregarAlIndice(Indice, r);
+}
+
+bool Historial::Completo()
+{
+    AdoptarCarga();
+    return Adoptado;
+}
+
+bool Historial::Consultar(int idNivel, float tiempo, Resumen& r)
+{
+    r = {};
+    if (!HiloHistorial.joinable()) return false;
+
+    AdoptarCarga();
+    r.Completo = Adoptado;
+
+    const IndiceNivel* n = BuscarNivel(Indice, idNivel);
+    if (n)
+    {
+        r.Carreras = n->Carreras;
+        r.Ganadas = n->Ganadas;
+        r.Mejor = n->Mejor;
+        r.Puesto = PuestoEnNivel(*n, tiempo);
+    }
+    return true;
+}
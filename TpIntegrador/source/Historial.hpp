@@ -0,0 +1,103 @@
+﻿#pragma once
+#include "Reglas.hpp"
+#include <vector>
+
+// ============================================================================
+// REGISTRO DE UNA CARRERA
+// ============================================================================
+// Una carrera terminada (ganada o perdida), tal cual se guarda en el
+// archivo: registros de tamaño fijo, solo se agregan al final. La suma de
+// control detecta un registro cortado o dañado (por ejemplo, si el proceso
+// murió a mitad de una escritura): la carga se detiene en el primero malo.
+// ============================================================================
+struct RegistroCarrera
+{
+    long long Fecha;            // Segundos desde 1970 (time)
+    float Tiempo;               // Segundos jugados
+    int IdNivel;
+    unsigned char Motivo;       // MotivoPerdida (SIN_PERDIDA = ganó)
+    unsigned char Saltos;
+    unsigned short Reservado;   // Relleno explícito (siempre 0)
+    unsigned int Suma;          // FNV-1a de los bytes anteriores
+};
+
+static_assert(sizeof(RegistroCarrera) == 24, "RegistroCarrera cambia el formato del historial");
+
+// Calcula la suma de control de 'r' (sin mirar r.Suma)
+unsigned int SumaRegistro(const RegistroCarrera& r);
+
+// ============================================================================
+// ÍNDICE DE CARRERAS POR NIVEL
+// ============================================================================
+// Para el puesto de un tiempo alcanza con saber cuántas carreras ganadas
+// fueron más rápidas. Los tiempos se agrupan en centésimas (lo que muestra
+// la pantalla) y se cuentan en un árbol de Fenwick: agregar y consultar el
+// puesto cuestan O(log CubetasTiempo), haya cien carreras o un millón.
+// Dos índices del mismo nivel se suman elemento a elemento.
+// ============================================================================
+const int CubetasTiempo = (int)(TiempoLimite * 100) + 1;    // La última junta todo lo más lento
+
+struct IndiceNivel
+{
+    int IdNivel;
+    int Carreras;
+    int Ganadas;
+    int PorMotivo[PERDIDA_PINCHOS + 1];     // Cuántas terminaron con cada MotivoPerdida
+    float Mejor;                            // Mejor tiempo ganado (0 si no ganó nunca)
+    std::vector<int> Arbol;                 // Fenwick sobre CubetasTiempo (base 1)
+};
+
+struct IndiceCarreras
+{
+    std::vector<IndiceNivel> Niveles;
+};
+
+void AgregarAlIndice(IndiceCarreras& indice, const RegistroCarrera& r);
+
+// Suma 'otro' a 'indice' (la carga de fondo se junta con lo registrado mientras tanto)
+void SumarIndice(IndiceCarreras& indice, const IndiceCarreras& otro);
+
+// nullptr si el nivel no tiene carreras
+const IndiceNivel* BuscarNivel(const IndiceCarreras& indice, int idNivel);
+
+// Puesto de 'tiempo' entre las ganadas del nivel (1 = el mejor; empata con
+// los de la misma centésima)
+int PuestoEnNivel(const IndiceNivel& nivel, float tiempo);
+
+// ============================================================================
+// HISTORIAL (ARCHIVO + HILO DE ESCRITURA)
+// ============================================================================
+// Un hilo propio carga el archivo al iniciar y después escribe en tandas lo
+// que el juego registra. El hilo principal solo encola registros en una
+// cola sin locks y consulta su índice en memoria: ni registrar ni consultar
+// tocan el disco ni esperan al hilo.
+//
+// Mientras la carga no terminó, el índice solo tiene lo registrado en esta
+// sesión (Resumen::Completo = false). Sin Iniciar(), Registrar no hace nada.
+// ============================================================================
+namespace Historial
+{
+    // Abre (o crea) el archivo y arranca el hilo
+    void Iniciar(const char* ruta);
+
+    // Escribe lo pendiente y detiene el hilo
+    void Detener();
+
+    // Agrega una carrera terminada
+    void Registrar(int idNivel, float tiempo, MotivoPerdida motivo, int saltos);
+
+    struct Resumen
+    {
+        bool Completo;          // Ya incluye todas las carreras del archivo
+        int Carreras;
+        int Ganadas;
+        float Mejor;            // Mejor tiempo (0 si no hay ganadas)
+        int Puesto;             // Puesto del tiempo consultado
+    };
+
+    // Resumen del nivel y puesto de 'tiempo'. false si no hay historial.
+    bool Consultar(int idNivel, float tiempo, Resumen& r);
+
+    // true cuando el índice ya incluye todo el archivo
+    bool Completo();
+}
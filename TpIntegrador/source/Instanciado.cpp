@@ -0,0 +1,257 @@
+﻿#include "Instanciado.hpp"
+#include "raylib.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <cstddef>
+
+// ============================================================================
+// DATOS POR INSTANCIA (lo que se sube al buffer dinámico)
+// ============================================================================
+struct Instancia
+{
+    float Destino[4];           // x, y, ancho, alto en pantalla
+    float Fuente[4];            // u0, v0, u1, v1 (u1 < u0 = espejado)
+    unsigned char Tinte[4];     // RGBA
+};
+
+const int MaxInstancias = 16384;        // Por llamada a Dibujar(); si se llena, se dibuja antes
+
+// ============================================================================
+// SHADER (posición y UV salen de la instancia, el quad es siempre 0..1)
+// ============================================================================
+static const char* CodigoVertices = R"(
+#version 330
+in vec2 vertexPosition;
+in vec4 instDestino;
+in vec4 instFuente;
+in vec4 instTinte;
+uniform mat4 mvp;
+out vec2 fragTexCoord;
+out vec4 fragColor;
+void main()
+{
+    fragTexCoord = mix(instFuente.xy, instFuente.zw, vertexPosition);
+    fragColor = instTinte;
+    gl_Position = mvp * vec4(instDestino.xy + vertexPosition * instDestino.zw, 0.0, 1.0);
+}
+)";
+
+static const char* CodigoFragmentos = R"(
+#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform sampler2D texture0;
+out vec4 finalColor;
+void main()
+{
+    finalColor = texture(texture0, fragTexCoord) * fragColor;
+}
+)";
+
+// Dos triángulos en el mismo orden que los quads de raylib (no los descarta el culling)
+static const float EsquinasQuad[12] = { 0, 0,  0, 1,  1, 1,  0, 0,  1, 1,  1, 0 };
+
+// ============================================================================
+// ESTADO
+// ============================================================================
+static bool Listo = false;
+static unsigned int Programa = 0;
+static unsigned int Vao = 0;
+static unsigned int VboQuad = 0;
+static unsigned int VboInstancias = 0;
+static int LocMvp = -1;
+static int LocDestino = -1, LocFuente = -1, LocTinte = -1;
+
+// Encoladas desde el último Dibujar(), en orden de llegada
+static Instancia Pendientes[MaxInstancias];
+static unsigned int TexturaPendiente[MaxInstancias];    // Id de la textura de cada una
+static int NumPendientes = 0;
+
+// Próxima posición libre del buffer en la GPU. Se llena de corrido: lo que
+// se sube no pisa lo que todavía se puede estar dibujando. Al llegar al
+// final el buffer se reemplaza por uno nuevo (huérfano) en vez de volver
+// al principio del mismo.
+static int CursorGPU = 0;
+
+// ============================================================================
+// INICIO / LIBERACIÓN
+// ============================================================================
+bool Instanciado::Iniciar()
+{
+    // Sin divisor de atributos (OpenGL 1.1 / 2.1 / ES 2.0) queda el camino común
+    int version = rlGetVersion();
+    if (version != OPENGL_33 && version != OPENGL_43)
+    {
+        TraceLog(LOG_INFO, "INSTANCIADO: no disponible, se dibuja un quad por instancia");
+        return false;
+    }
+
+    Programa = rlLoadShaderCode(CodigoVertices, CodigoFragmentos);
+    if (Programa == 0) return false;
+
+    LocMvp = rlGetLocationUniform(Programa, "mvp");
+    int locPosicion = rlGetLocationAttrib(Programa, "vertexPosition");
+    LocDestino = rlGetLocationAttrib(Programa, "instDestino");
+    LocFuente = rlGetLocationAttrib(Programa, "instFuente");
+    LocTinte = rlGetLocationAttrib(Programa, "instTinte");
+
+    Vao = rlLoadVertexArray();
+    rlEnableVertexArray(Vao);
+
+    VboQuad = rlLoadVertexBuffer(EsquinasQuad, sizeof(EsquinasQuad), false);
+    rlSetVertexAttribute(locPosicion, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(locPosicion);
+
+    // Los punteros de las instancias se fijan en cada Dibujar() (cambian con
+    // el cursor y con el buffer)
+    VboInstancias = rlLoadVertexBuffer(nullptr, MaxInstancias * (int)sizeof(Instancia), true);
+    rlEnableVertexAttribute(LocDestino);
+    rlEnableVertexAttribute(LocFuente);
+    rlEnableVertexAttribute(LocTinte);
+    rlSetVertexAttributeDivisor(LocDestino, 1);
+    rlSetVertexAttributeDivisor(LocFuente, 1);
+    rlSetVertexAttributeDivisor(LocTinte, 1);
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+
+    Listo = true;
+    return true;
+}
+
+void Instanciado::Liberar()
+{
+    if (!Listo) return;
+
+    rlUnloadVertexArray(Vao);
+    rlUnloadVertexBuffer(VboQuad);
+    rlUnloadVertexBuffer(VboInstancias);
+    rlUnloadShaderProgram(Programa);
+
+    Listo = false;
+    NumPendientes = 0;
+}
+
+// ============================================================================
+// ENCOLAR
+// ============================================================================
+void Instanciado::Agregar(const Texture2D& textura, Rectangle fuente, Rectangle destino, Color tinte)
+{
+    if (!Listo)
+    {
+        DrawTexturePro(textura, fuente, destino, { 0, 0 }, 0, tinte);
+        return;
+    }
+
+    if (NumPendientes == MaxInstancias) Dibujar();
+
+    float w = (float)textura.width;
+    float h = (float)textura.height;
+
+    Instancia& i = Pendientes[NumPendientes];
+    i.Destino[0] = destino.x;
+    i.Destino[1] = destino.y;
+    i.Destino[2] = destino.width;
+    i.Destino[3] = destino.height;
+    i.Fuente[0] = fuente.x / w;
+    i.Fuente[1] = fuente.y / h;
+    i.Fuente[2] = (fuente.x + fuente.width) / w;
+    i.Fuente[3] = (fuente.y + fuente.height) / h;
+    i.Tinte[0] = tinte.r;
+    i.Tinte[1] = tinte.g;
+    i.Tinte[2] = tinte.b;
+    i.Tinte[3] = tinte.a;
+
+    TexturaPendiente[NumPendientes++] = textura.id;
+}
+
+// ============================================================================
+// CONTEO DE LLAMADAS DE DIBUJO
+// ============================================================================
+static const rlRenderBatch* LoteContado = nullptr;
+static int Llamadas = 0;
+
+void Instanciado::ContarLote(const rlRenderBatch* lote)
+{
+    LoteContado = lote;
+}
+
+void Instanciado::VaciarLote()
+{
+    // Cada entrada del lote con vértices sale como una llamada
+    if (LoteContado)
+        for (int i = 0; i < LoteContado->drawCounter; i++)
+            if (LoteContado->draws[i].vertexCount > 0) Llamadas++;
+
+    rlDrawRenderBatchActive();
+}
+
+void Instanciado::ContarLlamadas(int cantidad)
+{
+    Llamadas += cantidad;
+}
+
+int Instanciado::TomarLlamadas()
+{
+    int n = Llamadas;
+    Llamadas = 0;
+    return n;
+}
+
+// ============================================================================
+// DIBUJAR
+// ============================================================================
+// Las instancias se dibujan en el orden en que llegaron: cada tramo seguido
+// con la misma textura es una llamada. Reordenar por textura juntaría más,
+// pero con A, B, A la segunda A quedaría debajo de B.
+void Instanciado::Dibujar()
+{
+    if (NumPendientes == 0) return;
+
+    // --- Una sola subida al buffer dinámico ---
+    // Lleno: se suelta el buffer y se pide otro del mismo tamaño. El driver
+    // conserva el viejo hasta que terminen las llamadas que lo leen, así la
+    // subida nueva no espera a la GPU ni pisa datos en uso.
+    int bytes = NumPendientes * (int)sizeof(Instancia);
+    if (CursorGPU + bytes > MaxInstancias * (int)sizeof(Instancia))
+    {
+        rlUnloadVertexBuffer(VboInstancias);
+        VboInstancias = rlLoadVertexBuffer(nullptr, MaxInstancias * (int)sizeof(Instancia), true);
+        CursorGPU = 0;
+    }
+    rlUpdateVertexBuffer(VboInstancias, Pendientes, bytes, CursorGPU);
+
+    // Lo que raylib tenía pendiente va debajo
+    VaciarLote();
+
+    rlEnableShader(Programa);
+    rlSetUniformMatrix(LocMvp, MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection()));
+    rlEnableVertexArray(Vao);
+    rlEnableVertexBuffer(VboInstancias);
+    rlActiveTextureSlot(0);
+
+    // --- Una llamada instanciada por tramo de la misma textura ---
+    for (int inicio = 0, fin; inicio < NumPendientes; inicio = fin)
+    {
+        unsigned int textura = TexturaPendiente[inicio];
+        for (fin = inicio + 1; fin < NumPendientes && TexturaPendiente[fin] == textura; fin++) {}
+        int cantidad = fin - inicio;
+
+        size_t base = (size_t)CursorGPU + (size_t)inicio * sizeof(Instancia);
+        rlSetVertexAttribute(LocDestino, 4, RL_FLOAT, false, sizeof(Instancia), (const void*)(base + offsetof(Instancia, Destino)));
+        rlSetVertexAttribute(LocFuente, 4, RL_FLOAT, false, sizeof(Instancia), (const void*)(base + offsetof(Instancia, Fuente)));
+        rlSetVertexAttribute(LocTinte, 4, RL_UNSIGNED_BYTE, true, sizeof(Instancia), (const void*)(base + offsetof(Instancia, Tinte)));
+
+        rlEnableTexture(textura);
+        rlDrawVertexArrayInstanced(0, 6, cantidad);
+        ContarLlamadas(1);
+    }
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableTexture();
+    rlDisableShader();
+
+    CursorGPU += bytes;
+    NumPendientes = 0;
+}
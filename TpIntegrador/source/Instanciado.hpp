@@ -0,0 +1,60 @@
+﻿#pragma once
+#include "raylib.h"
+
+struct rlRenderBatch;
+
+// ============================================================================
+// DIBUJO INSTANCIADO
+// ============================================================================
+// Para lo que se repite muchas veces con la misma textura (plataformas,
+// cajas, murciélagos). Agregar() solo copia los datos
+// de la instancia (destino, UV y tinte) a un arreglo; Dibujar() los sube
+// juntos a un buffer de vértices dinámico y hace una llamada instanciada
+// por cada tramo seguido con la misma textura. El costo de CPU por frame
+// ya no depende de cuántas instancias haya sino de cuántos cambios de
+// textura: conviene encolar agrupado por textura.
+//
+// Dibujar() respeta el orden de pintado: las instancias salen en el orden
+// en que se encolaron, lo encolado va por encima de lo que raylib ya tenía
+// pendiente y por debajo de lo que se dibuje después. Se llama al terminar
+// cada capa.
+//
+// Sin Iniciar() (herramientas sin ventana) o si la GPU no soporta
+// instanciado, Agregar() dibuja en el momento con DrawTexturePro: mismo
+// resultado, un quad por instancia en el lote normal de raylib.
+// ============================================================================
+namespace Instanciado
+{
+    // Carga el shader y los buffers (requiere InitWindow).
+    // Devuelve false si se queda con el camino sin instanciado.
+    bool Iniciar();
+
+    // Libera shader y buffers
+    void Liberar();
+
+    // Encola una instancia (mismos parámetros que DrawTexturePro, sin
+    // rotación). Un ancho negativo en 'fuente' la espeja.
+    void Agregar(const Texture2D& textura, Rectangle fuente, Rectangle destino, Color tinte);
+
+    // Dibuja lo encolado: una llamada por tramo de la misma textura
+    void Dibujar();
+
+    // --- Conteo de llamadas de dibujo (para el arnés de regresión) ---
+    // El lote de raylib lleva su propio contador, pero vaciarlo a mitad del
+    // frame lo vuelve a cero, y DrawMesh y las llamadas instanciadas no pasan
+    // por él. Todo lo que vacía el lote lo hace con VaciarLote() y todo lo
+    // que dibuja por fuera lo anota con ContarLlamadas().
+
+    // Lote cuyas llamadas se cuentan al vaciarlo (el de raylib es interno:
+    // hay que pasar uno propio). Sin lote solo cuenta lo de afuera.
+    void ContarLote(const rlRenderBatch* lote);
+
+    // Manda lo pendiente del lote activo a la GPU, sumando antes sus llamadas
+    void VaciarLote();
+
+    // Suma llamadas hechas por fuera del lote
+    void ContarLlamadas(int cantidad);
+
+    // Llamadas desde la vez anterior (y vuelve el contador a cero)
+    int TomarLlamadas();
+}
@@ -0,0 +1,166 @@
+﻿#include "Instantanea.hpp"
+#include "Nivel.hpp"
+#include "Player.hpp"
+#include "Puerta.hpp"
+#include <cstring>
+
+// ============================================================================
+// TOMAR / RESTAURAR
+// ============================================================================
+// Las instantáneas se comparan byte a byte (memcmp), así que los huecos de
+// relleno entre campos tienen que quedar en cero. La instantánea se limpia
+// entera y después se copia campo por campo: una asignación de struct o un
+// agregado temporal puede copiar el relleno basura del origen.
+//
+// Si cambia el tamaño de estos structs es que cambiaron sus campos: hay
+// que actualizar las copias de abajo.
+static_assert(sizeof(EstadoJugador) == 40, "Revisar CopiarJugador");
+static_assert(sizeof(EstadoAnimacion) == 8, "Revisar CopiarAnimacion");
+
+static void CopiarJugador(EstadoJugador& d, const EstadoJugador& o)
+{
+    d.Posicion = o.Posicion;
+    d.Velocidad = o.Velocidad;
+    d.Ancho = o.Ancho;
+    d.Alto = o.Alto;
+    d.BufferSalto = o.BufferSalto;
+    d.ContadorSaltos = o.ContadorSaltos;
+    d.EnSuelo = o.EnSuelo;
+    d.TipoActual = o.TipoActual;
+    d.MirandoDerecha = o.MirandoDerecha;
+    d.Moviendo = o.Moviendo;
+    d.Apoyo = o.Apoyo;
+}
+
+static void CopiarAnimacion(EstadoAnimacion& d, const EstadoAnimacion& o)
+{
+    d.Clip = o.Clip;
+    d.Tiempo = o.Tiempo;
+}
+
+bool TomarInstantanea(InstantaneaPartida& i, const Nivel& nivel, const Player& jugador,
+                      const Puerta& puerta, float tiempoJugado)
+{
+    if (nivel.NumEnemigos > MaxEnemigosInstantanea || nivel.NumPlataformasMoviles > MaxMovilesInstantanea)
+        return false;
+
+    // Relleno y lugares sin usar de Enemigos/Moviles en cero
+    std::memset(&i, 0, sizeof(InstantaneaPartida));
+
+    i.IdNivel = nivel.Id;
+    i.TiempoJugado = tiempoJugado;
+
+    CopiarJugador(i.Jugador, jugador.Fisica);
+    CopiarAnimacion(i.AnimacionJugador, jugador.Animacion);
+    i.TimerPaso = jugador.TimerPaso;
+
+    i.PuertaAbierta = puerta.EstaAbierta;
+    i.MostrarDialogo = puerta.MostrarDialogo;
+
+    i.NumEnemigos = nivel.NumEnemigos;
+    for (int k = 0; k < nivel.NumEnemigos; k++)
+    {
+        const Enemigo& e = nivel.Enemigos[k];
+        EnemigoInstantanea& d = i.Enemigos[k];
+        d.Posicion = e.Posicion;
+        d.Velocidad = e.Velocidad;
+        CopiarAnimacion(d.Animacion, e.Animacion);
+        d.Fase = e.Fase;
+        d.Picada = e.Picada;
+        d.Destino = e.Destino;
+        d.PuntoActual = e.PuntoActual;
+    }
+
+    i.NumMoviles = nivel.NumPlataformasMoviles;
+    for (int k = 0; k < nivel.NumPlataformasMoviles; k++)
+    {
+        const PlataformaMovil& m = nivel.PlataformasMoviles[k];
+        MovilInstantanea& d = i.Moviles[k];
+        d.Posicion = m.Base.Posicion;
+        d.Recorrido = m.Recorrido;
+        d.Sentido = m.Sentido;
+        d.Desplazamiento = m.Desplazamiento;
+    }
+
+    return true;
+}
+
+void RestaurarInstantanea(const InstantaneaPartida& i, Nivel& nivel, Player& jugador,
+                          Puerta& puerta, float& tiempoJugado)
+{
+    tiempoJugado = i.TiempoJugado;
+
+    jugador.Fisica = i.Jugador;
+    jugador.Animacion = i.AnimacionJugador;
+    jugador.TimerPaso = i.TimerPaso;
+
+    puerta.EstaAbierta = i.PuertaAbierta;
+    puerta.MostrarDialogo = i.MostrarDialogo;
+
+    // Entidades y sus AABB en el Mundo (mismo recorrido que ActualizarEnemigos)
+    for (int k = 0; k < i.NumEnemigos; k++)
+    {
+        Enemigo& e = nivel.Enemigos[k];
+        e.Posicion = i.Enemigos[k].Posicion;
+        e.Velocidad = i.Enemigos[k].Velocidad;
+        e.Animacion = i.Enemigos[k].Animacion;
+        e.Fase = i.Enemigos[k].Fase;
+        e.Picada = i.Enemigos[k].Picada;
+        e.Destino = i.Enemigos[k].Destino;
+        e.PuntoActual = i.Enemigos[k].PuntoActual;
+        nivel.RectEnemigos[k].x = e.Posicion.x;
+        nivel.RectEnemigos[k].y = e.Posicion.y;
+    }
+
+    Vector2* desplazamientos = nivel.Mundo.Desplazamientos + nivel.NumEnemigos;
+    for (int k = 0; k < i.NumMoviles; k++)
+    {
+        PlataformaMovil& m = nivel.PlataformasMoviles[k];
+        m.Base.Posicion = i.Moviles[k].Posicion;
+        m.Recorrido = i.Moviles[k].Recorrido;
+        m.Sentido = i.Moviles[k].Sentido;
+        m.Desplazamiento = i.Moviles[k].Desplazamiento;
+        nivel.RectMoviles[k].x = m.Base.Posicion.x;
+        nivel.RectMoviles[k].y = m.Base.Posicion.y;
+        desplazamientos[k] = m.Desplazamiento;
+    }
+
+    ActualizarDinamicos(nivel.Mundo);
+}
+
+// ============================================================================
+// ANILLO
+// ============================================================================
+void ReservarAnillo(AnilloInstantaneas& a, int capacidad)
+{
+    a.Datos.assign(capacidad, InstantaneaPartida{});
+    VaciarAnillo(a);
+}
+
+void VaciarAnillo(AnilloInstantaneas& a)
+{
+    a.Inicio = 0;
+    a.Cantidad = 0;
+}
+
+InstantaneaPartida* EmpujarInstantanea(AnilloInstantaneas& a)
+{
+    int capacidad = (int)a.Datos.size();
+    if (capacidad == 0) return nullptr;
+
+    int lugar = (a.Inicio + a.Cantidad) % capacidad;
+
+    if (a.Cantidad < capacidad) a.Cantidad++;
+    else a.Inicio = (a.Inicio + 1) % capacidad;     // Lleno: se pisa la más vieja
+
+    return &a.Datos[lugar];
+}
+
+bool SacarInstantanea(AnilloInstantaneas& a, InstantaneaPartida& i)
+{
+    if (a.Cantidad == 0) return false;
+
+    a.Cantidad--;
+    std::memcpy(&i, &a.Datos[(a.Inicio + a.Cantidad) % a.Datos.size()], sizeof(InstantaneaPartida));
+    return true;
+}
@@ -0,0 +1,106 @@
+﻿#pragma once
+#include "raylib.h"
+#include "FisicaJugador.hpp"
+#include "Animacion.hpp"
+#include "Enemigo.hpp"
+#include <type_traits>
+#include <vector>
+
+struct Nivel;
+class Player;
+class Puerta;
+
+// ============================================================================
+// INSTANTÁNEA DE LA PARTIDA
+// ============================================================================
+// Todo lo que la simulación cambia mientras se juega, en un POD de tamaño
+// fijo: se copia con memcpy, se guarda en un anillo para rebobinar o se
+// usa para probar varias continuaciones desde el mismo punto.
+//
+// Lo que no cambia al jugar (plataformas, cajas, terreno, límites de los
+// murciélagos) queda en el Nivel y no se copia. Una instantánea solo se
+// restaura sobre el mismo nivel del que se tomó.
+//
+// El tamaño fijo pone un tope: un nivel con más de MaxEnemigosInstantanea
+// murciélagos o MaxMovilesInstantanea plataformas móviles no entra. En ese
+// caso el juego avisa al cargar, R reinicia reconstruyendo el nivel (más
+// lento) y BACKSPACE no rebobina; VerificarNivel descarta el nivel.
+// ============================================================================
+const int MaxEnemigosInstantanea = 32;
+const int MaxMovilesInstantanea = 16;
+
+struct EnemigoInstantanea
+{
+    Vector2 Posicion;
+    float Velocidad;                // El signo es el sentido
+    EstadoAnimacion Animacion;
+    float Fase;                     // Estado del comportamiento (onda, picada, ruta)
+    FasePicada Picada;
+    Vector2 Destino;
+    int PuntoActual;
+};
+
+struct MovilInstantanea
+{
+    Vector2 Posicion;
+    float Recorrido;
+    float Sentido;
+    Vector2 Desplazamiento;         // Lo que lleva al jugador parado encima
+};
+
+struct InstantaneaPartida
+{
+    int IdNivel;
+    float TiempoJugado;
+
+    // --- Jugador ---
+    EstadoJugador Jugador;
+    EstadoAnimacion AnimacionJugador;
+    float TimerPaso;
+
+    // --- Puerta ---
+    bool PuertaAbierta;
+    bool MostrarDialogo;
+
+    // --- Nivel (solo lo que se mueve) ---
+    int NumEnemigos;
+    int NumMoviles;
+    EnemigoInstantanea Enemigos[MaxEnemigosInstantanea];
+    MovilInstantanea Moviles[MaxMovilesInstantanea];
+};
+
+static_assert(std::is_trivially_copyable<InstantaneaPartida>::value,
+    "InstantaneaPartida se copia con memcpy");
+
+// Copia el estado actual (con el relleno y los lugares sin usar en cero,
+// así dos instantáneas del mismo estado son iguales byte a byte).
+// Devuelve false si el nivel tiene más murciélagos o plataformas móviles
+// de los que entran.
+bool TomarInstantanea(InstantaneaPartida& i, const Nivel& nivel, const Player& jugador,
+                      const Puerta& puerta, float tiempoJugado);
+
+// Vuelve al estado guardado (incluye los AABB dinámicos del Mundo)
+void RestaurarInstantanea(const InstantaneaPartida& i, Nivel& nivel, Player& jugador,
+                          Puerta& puerta, float& tiempoJugado);
+
+// ============================================================================
+// ANILLO DE INSTANTÁNEAS (REBOBINADO)
+// ============================================================================
+// Capacidad fija reservada una sola vez; al llenarse pisa la más vieja.
+// ============================================================================
+struct AnilloInstantaneas
+{
+    std::vector<InstantaneaPartida> Datos;
+    int Inicio;                 // La más vieja
+    int Cantidad;
+};
+
+void ReservarAnillo(AnilloInstantaneas& a, int capacidad);
+void VaciarAnillo(AnilloInstantaneas& a);
+
+// Lugar para la próxima instantánea (la escribe quien llama).
+// nullptr si el anillo no tiene capacidad.
+InstantaneaPartida* EmpujarInstantanea(AnilloInstantaneas& a);
+
+// Saca la más nueva. Devuelve false si no queda ninguna.
+bool SacarInstantanea(AnilloInstantaneas& a, InstantaneaPartida& i);
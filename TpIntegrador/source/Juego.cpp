@@ -0,0 +1,963 @@
+﻿#include "Juego.hpp"
+#include "raylib.h"
+#include "Recursos.hpp"     // Texturas compartidas por las entidades
+#include "Audio.hpp"        // Pool de voces para los efectos de sonido (consume eventos)
+#include "Escenarios.hpp"   // Funciones de dibujo del escenario completo
+#include "Particulas.hpp"   // Polvo, impactos y muertes (consume eventos)
+#include "Instanciado.hpp"  // Vaciado del lote con conteo de llamadas
+#include <utility>
+
+// Ticks que entran en el tiempo límite (más un frame de margen): la carrera
+// en curso se graba sin realocar
+static const int TicksCarreraMax = (int)(TiempoLimite / DtTick) + MaxTicksPorFrame;
+
+// ============================================================================
+// CONSTRUCTOR: estado inicial (las texturas se cargan en Iniciar)
+// ============================================================================
+Juego::Juego()
+    : ArenaPantallas(4 * 1024), Arena(64 * 1024)
+{
+    TexturaFondo = TexturaBoton = TexturaTrofeo = TexturaMarcoFinal = {};
+    TexturaControles1 = TexturaControles2 = TexturaReloj = TexturaPosicion = {};
+    TexturaArbol = TexturaMarcoPerdiste = TexturaFlecha = TexturaSaltos = {};
+    PixelFont = {};
+    IniciarParallax(FondoNivel);
+
+    Estado = MENU;
+    MostrarControles = false;
+    TiempoJugado = 0.0f;
+    TiempoFinal = 0.0f;
+    TemporizadorFinal = 0.0f;
+    Motivo = SIN_PERDIDA;
+    AcumuladoTick = 0.0f;
+    PulsosPendientes = 0;
+    IniciarEventos(Eventos);
+
+    HoverPlayPrev = false;
+    HoverExitPrev = false;
+    HoverRetryPrev = false;
+    HoverMenuPrev = false;
+
+    RectPlay = {};
+    RectExit = {};
+    TilesNecesarios = 0;
+    SueloGanaste = {};
+    SueloPerdiste = {};
+    RedibujoParcial = true;
+    PantallaFija = {};
+    PantallaFijaLista = false;
+    PosRetry = PosMenu = {};
+    ResumenCompleto = false;
+    NivelActual = {};
+    Desafio = nullptr;
+    IdDesafio = 0;
+    Inicial = {};
+    InicialValida = false;
+    Rebobinado = {};
+
+    RutaMejorCarrera = nullptr;
+    Mejor = {};
+    HayMejor = false;
+    ReiniciarLector(LectorMejor);
+    Trayectoria = {};
+    TicksCarrera = 0;
+    CarreraValida = true;
+}
+
+// ============================================================================
+// ARCHIVO DE LA MEJOR CARRERA
+// ============================================================================
+void Juego::UsarMejorCarrera(const char* ruta)
+{
+    RutaMejorCarrera = ruta;
+}
+
+void Juego::UsarDesafio(int id, const DisenoNivel& diseno)
+{
+    Desafio = &diseno;
+    IdDesafio = id;
+}
+
+// ============================================================================
+// CARGA DE TEXTURAS, FUENTE Y NIVEL
+// ============================================================================
+// Cargas y descargas anotadas en Recursos (recursos vivos)
+static Texture2D CargarTextura(const char* ruta)
+{
+    Texture2D t = LoadTexture(ruta);
+    if (t.id > 0) Recursos::Anotar(REC_TEXTURA, 1);
+    return t;
+}
+
+static void DescargarTextura(Texture2D& t)
+{
+    if (t.id > 0) Recursos::Anotar(REC_TEXTURA, -1);
+    UnloadTexture(t);
+    t = {};
+}
+
+bool Juego::Iniciar()
+{
+    TexturaFondo = CargarTextura("Fondo.png");
+    TexturaBoton = CargarTextura("Boton.png");
+    TexturaTrofeo = CargarTextura("Trofeo.png");
+    TexturaMarcoFinal = CargarTextura("MarcoFinal.png");
+
+    TexturaControles1 = CargarTextura("controles1.png");
+    TexturaControles2 = CargarTextura("Controles2.png");
+    TexturaReloj = CargarTextura("Reloj.png");
+    TexturaPosicion = CargarTextura("posicion.png");
+    TexturaArbol = CargarTextura("Arbol.png");
+    TexturaMarcoPerdiste = CargarTextura("MarcoPerdiste.png");
+    TexturaFlecha = CargarTextura("Flecha.png");
+    TexturaSaltos = CargarTextura("Saltos.png");
+
+    // Fondo del nivel en capas (por ahora una: el cielo, casi quieto)
+    IniciarParallax(FondoNivel);
+    AgregarCapaParallax(FondoNivel, TexturaFondo, 0.2f, 0, 1.0f);
+
+    PixelFont = LoadFont("PressStart2P.ttf");             // Cargamos la fuente principal tipo "pixel art"
+    if (PixelFont.texture.id > 0) Recursos::Anotar(REC_TEXTURA, 1);
+    SetTextureFilter(PixelFont.texture, TEXTURE_FILTER_POINT); // Forzamos filtrado punto para conservar estética retro
+
+    // Asignamos la fuente pixelada a la puerta para sus diálogos
+    LaPuerta.SetFont(PixelFont);
+
+    // Dimensiones escaladas para los botones del menú
+    float escalaBoton = 0.4f;
+    float W = (float)(int)(TexturaBoton.width * escalaBoton);
+    float H = (float)(int)(TexturaBoton.height * escalaBoton);
+
+    RectPlay = { (float)(512 - (int)W / 2), 400, W, H };   // Botón PLAY centrado
+    RectExit = { (float)(512 - (int)W / 2), 500, W, H };   // Botón EXIT centrado
+
+    TilesNecesarios = GetScreenWidth() / 64 + 2;
+
+    // Una fila de suelo y una de pinchos para las pantallas finales
+    unsigned char fila[64];
+    int columnas = TilesNecesarios < 64 ? TilesNecesarios : 64;
+    for (int i = 0; i < columnas; i++) fila[i] = TILE_SUELO;
+    IniciarCapa(SueloGanaste, ArenaPantallas, fila, columnas, 1, { 0, 640 });
+    for (int i = 0; i < columnas; i++) fila[i] = TILE_PINCHOS;
+    IniciarCapa(SueloPerdiste, ArenaPantallas, fila, columnas, 1, { 0, 640 });
+
+    // Destino de la parte fija de GANASTE / PERDISTE
+    PantallaFija = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+    if (PantallaFija.id > 0) Recursos::Anotar(REC_TEXTURA, 1);
+
+    // Construimos el nivel a partir de sus tablas de aparición
+    bool nivelOk = Desafio ? ConstruirNivel(IdDesafio, *Desafio, Arena, NivelActual)
+                           : CargarNivel(1, Arena, NivelActual);
+    if (!nivelOk)
+        return false;
+
+    // Estado recién cargado (reiniciar) y 5 segundos de rebobinado a 60 FPS
+    InicialValida = TomarInstantanea(Inicial, NivelActual, Jugador, LaPuerta, 0.0f);
+    if (!InicialValida)
+        TraceLog(LOG_WARNING, "JUEGO: el nivel tiene %i murciélagos y %i plataformas móviles (la instantánea admite %i y %i): "
+                 "R reinicia reconstruyendo el nivel y BACKSPACE no rebobina",
+                 NivelActual.NumEnemigos, NivelActual.NumPlataformasMoviles,
+                 MaxEnemigosInstantanea, MaxMovilesInstantanea);
+    ReservarAnillo(Rebobinado, 300);
+
+    // Récord anterior de este nivel (si hay) y lugar para grabar la carrera
+    HayMejor = RutaMejorCarrera && CargarMejorCarrera(RutaMejorCarrera, Mejor) && Mejor.IdNivel == NivelActual.Id;
+    VaciarTrayectoria(Trayectoria, TicksCarreraMax);
+    EntradasCarrera.reserve(TicksCarreraMax);
+
+    ReportarMemoriaNivel(NivelActual, Arena);
+    return true;
+}
+
+// ============================================================================
+// LIBERACIÓN DE TEXTURAS, FUENTE Y NIVEL
+// ============================================================================
+void Juego::Liberar()
+{
+    DescargarNivel(NivelActual, Arena);
+    LiberarCapa(SueloGanaste);
+    LiberarCapa(SueloPerdiste);
+    ArenaPantallas.Reiniciar();
+    if (PantallaFija.id > 0) Recursos::Anotar(REC_TEXTURA, -1);
+    UnloadRenderTexture(PantallaFija);
+    PantallaFija = {};
+
+    DescargarTextura(TexturaFondo);
+    IniciarParallax(FondoNivel);        // Sus capas usaban TexturaFondo
+    DescargarTextura(TexturaBoton);
+    DescargarTextura(TexturaTrofeo);
+    DescargarTextura(TexturaMarcoFinal);
+    DescargarTextura(TexturaControles1);
+    DescargarTextura(TexturaControles2);
+    DescargarTextura(TexturaReloj);
+    DescargarTextura(TexturaPosicion);
+    DescargarTextura(TexturaArbol);
+    DescargarTextura(TexturaMarcoPerdiste);
+    DescargarTextura(TexturaFlecha);
+    DescargarTextura(TexturaSaltos);
+
+    if (PixelFont.texture.id > 0) Recursos::Anotar(REC_TEXTURA, -1);
+    UnloadFont(PixelFont);
+}
+
+// ============================================================================
+// REINICIO DE LA PARTIDA
+// ============================================================================
+void Juego::ReiniciarPartida()
+{
+    Particulas::Vaciar();
+
+    if (InicialValida)
+    {
+        // Una copia de tamaño fijo: no se reconstruye nada
+        RestaurarInstantanea(Inicial, NivelActual, Jugador, LaPuerta, TiempoJugado);
+    }
+    else
+    {
+        LaPuerta.EstaAbierta = false;
+        TiempoJugado = 0.0f;
+        Jugador.Reiniciar();
+        ReiniciarNivel(NivelActual);
+    }
+
+    VaciarAnillo(Rebobinado);
+    VaciarTrayectoria(Trayectoria, TicksCarreraMax);
+    EntradasCarrera.clear();
+    TicksCarrera = 0;
+    CarreraValida = true;
+    ReiniciarLector(LectorMejor);
+    AcumuladoTick = 0.0f;
+    PulsosPendientes = 0;
+    PantallaFijaLista = false;
+}
+
+// ============================================================================
+// FRAME COMPLETO
+// ============================================================================
+bool Juego::Frame(const EntradaFrame& entrada)
+{
+    NuevoFrameEventos(Eventos);
+
+    // Alternar visualización de controles presionando M
+    if (Pulsado(entrada, ENT_CONTROLES))
+        MostrarControles = !MostrarControles;
+
+    bool salir = false;
+
+    switch (Estado)
+    {
+    case MENU:                  FrameMenu(entrada, salir); break;
+    case JUGANDO:               FrameJugando(entrada); break;
+    case TRANSICION_GANASTE:    FrameTransicionGanaste(entrada); break;
+    case GANASTE:               FrameGanaste(entrada); break;
+    case TRANSICION_PERDISTE:   FrameTransicionPerdiste(entrada); break;
+    case PERDISTE:              FramePerdiste(entrada); break;
+    }
+
+    ConsumirEventos();
+
+    // Efectos: en la partida y en las transiciones (la muerte se sigue
+    // viendo mientras el escenario queda quieto); fuera de eso no quedan
+    if (Estado == JUGANDO || Estado == TRANSICION_GANASTE || Estado == TRANSICION_PERDISTE)
+    {
+        float dt = entrada.Dt < MaxTicksPorFrame * DtTick ? entrada.Dt : MaxTicksPorFrame * DtTick;
+        Particulas::Actualizar(dt);
+        Particulas::Dibujar();
+    }
+    else Particulas::Vaciar();
+
+    return !salir;
+}
+
+// ============================================================================
+// CONSUMO DE EVENTOS
+// ============================================================================
+// Cada sistema recorre los eventos del frame en un solo bucle: el audio
+// (un sonido por evento, según el suelo o el botón) y las partículas.
+static void SonarEventos(const ColaEventos& eventos)
+{
+    const int num = NumEventosFrame(eventos);
+    for (int i = 0; i < num; i++)
+    {
+        const Evento& e = EventoFrame(eventos, i);
+        switch (e.Tipo)
+        {
+        case EV_SALTO:
+            if (e.Dato == SUELO_PASTO) Audio::Reproducir(SND_SALTO_PASTO, PRIORIDAD_NORMAL);
+            if (e.Dato == SUELO_CAJA) Audio::Reproducir(SND_SALTO_CAJA, PRIORIDAD_NORMAL);
+            break;
+
+        case EV_PISADA:
+            if (e.Dato == SUELO_PASTO) Audio::Reproducir(SND_CAMINAR_PASTO, PRIORIDAD_BAJA);
+            if (e.Dato == SUELO_CAJA) Audio::Reproducir(SND_CAMINAR_CAJA, PRIORIDAD_BAJA);
+            break;
+
+        case EV_VICTORIA:       Audio::Reproducir(SND_GANASTE, PRIORIDAD_ALTA); break;
+        case EV_DERROTA:        Audio::Reproducir(SND_PIERDE, PRIORIDAD_ALTA); break;
+        case EV_BOTON_ENCIMA:   Audio::Reproducir(SND_BOTON, PRIORIDAD_ALTA); break;
+        case EV_BOTON_PULSADO:  // EXIT cierra el juego: sin sonido
+            if (e.Dato != BOTON_EXIT) Audio::Reproducir(SND_TOCA_BOTON, PRIORIDAD_ALTA);
+            break;
+
+        default:                // Aterrizaje: sin sonido propio
+            break;
+        }
+    }
+}
+
+// Ráfagas de partículas (colores, velocidades, ángulos, vida, tamaño,
+// gravedad y arrastre). El polvo sale en abanico hacia arriba.
+static const EstiloRafaga PolvoPasto = {
+    { 96, 140, 56, 230 }, { 140, 112, 72, 200 }, 40, 120, -3.0f, -0.14f, 0.3f, 0.6f, 2, 4, 320, 3 };
+static const EstiloRafaga AstillasCaja = {
+    { 150, 100, 55, 240 }, { 205, 155, 95, 210 }, 50, 140, -3.0f, -0.14f, 0.3f, 0.7f, 2, 4, 500, 2 };
+static const EstiloRafaga ChispasPinchos = {
+    { 200, 30, 30, 255 }, { 160, 160, 170, 230 }, 120, 280, -2.8f, -0.34f, 0.6f, 1.0f, 3, 5, 650, 1 };
+static const EstiloRafaga NubeMurcielago = {
+    { 40, 20, 60, 240 }, { 120, 70, 140, 200 }, 60, 180, -3.14159f, 3.14159f, 0.5f, 0.9f, 3, 6, 60, 2 };
+
+static void EmitirEfectos(const ColaEventos& eventos)
+{
+    const int num = NumEventosFrame(eventos);
+    for (int i = 0; i < num; i++)
+    {
+        const Evento& e = EventoFrame(eventos, i);
+        const EstiloRafaga& polvo = e.Dato == SUELO_CAJA ? AstillasCaja : PolvoPasto;
+
+        switch (e.Tipo)
+        {
+        case EV_SALTO:          Particulas::Emitir(polvo, e.Posicion, 8); break;
+        case EV_ATERRIZAJE:     Particulas::Emitir(polvo, e.Posicion, 20); break;
+
+        case EV_DERROTA:
+            if (e.Dato == PERDIDA_PINCHOS) Particulas::Emitir(ChispasPinchos, e.Posicion, 60);
+            if (e.Dato == PERDIDA_MURCIELAGO) Particulas::Emitir(NubeMurcielago, e.Posicion, 50);
+            break;
+
+        default:
+            break;
+        }
+    }
+}
+
+void Juego::ConsumirEventos()
+{
+    SonarEventos(Eventos);
+    EmitirEfectos(Eventos);
+}
+
+bool Juego::PantallaQuieta() const
+{
+    return Estado == MENU || Estado == GANASTE || Estado == PERDISTE;
+}
+
+// ============================================================================
+// ESTADO: MENÚ PRINCIPAL
+// ============================================================================
+void Juego::FrameMenu(const EntradaFrame& entrada, bool& salir)
+{
+    DrawTexture(TexturaFondo, 0, 0, WHITE); // Fondo del menú
+    Vector2 mouse = entrada.Mouse;          // Posición actual del cursor
+
+    // --- TÍTULO PRINCIPAL DEL JUEGO ---
+    const char* titulo = "Plataformas 2D - TP Integrador";
+    int fontSize = 25;
+    float spacing = 1;
+
+    Vector2 sizeTitulo = MeasureTextEx(PixelFont, titulo, (float)fontSize, spacing);
+
+    float tituloX = 512 - sizeTitulo.x / 2;
+    float tituloY = 190;
+
+    DrawTextEx(
+        PixelFont,
+        titulo,
+        { tituloX, tituloY },
+        (float)fontSize,
+        spacing,
+        BLACK
+    );
+
+    // --- ANIMACIÓN DE BOTONES (cambio de escala según hover) ---  // "Hover" = cuando el cursor está por encima de un botón.
+    float escalaNormal = 0.40f;                                     // Cambiamos la escala del botón para dar feedback visual y reproducimos un sonido
+    float escalaHover = 0.36f;                                      // solo cuando el mouse entra en su área por primera vez.
+
+    // Hover sobre "PLAY"
+    float escalaPlay = CheckCollisionPointRec(mouse, RectPlay)
+        ? escalaHover : escalaNormal;
+
+    // Detectar entrada del mouse en PLAY
+    bool hoverPlay = CheckCollisionPointRec(mouse, RectPlay);
+    if (hoverPlay && !HoverPlayPrev)
+        PublicarEvento(Eventos, EV_BOTON_ENCIMA, BOTON_PLAY, mouse);    // Solo al entrar en hover
+
+    HoverPlayPrev = hoverPlay;
+
+    // Hover sobre "EXIT"
+    float escalaExit = CheckCollisionPointRec(mouse, RectExit)
+        ? escalaHover : escalaNormal;
+
+    // Detectar entrada del mouse en EXIT
+    bool hoverExit = CheckCollisionPointRec(mouse, RectExit);
+    if (hoverExit && !HoverExitPrev)
+    {
+        PublicarEvento(Eventos, EV_BOTON_ENCIMA, BOTON_EXIT, mouse);    // Solo al entrar en hover
+    }
+    HoverExitPrev = hoverExit;
+
+    // Recalcular tamaños según la escala actual
+    float playW = TexturaBoton.width * escalaPlay;
+    float playH = TexturaBoton.height * escalaPlay;
+    float exitW = TexturaBoton.width * escalaExit;
+    float exitH = TexturaBoton.height * escalaExit;
+
+    // Recalcular posiciones centradas
+    float playX = 512 - playW / 2;
+    float playY = RectPlay.y;
+    float exitX = 512 - exitW / 2;
+    float exitY = RectExit.y;
+
+    // --- DIBUJAR BOTÓN PLAY ---
+    DrawTextureEx(TexturaBoton, { playX, playY }, 0, escalaPlay, WHITE);
+
+    const char* txtPlay = "PLAY";
+    int fsPlay = 28;
+    Vector2 szPlay = MeasureTextEx(PixelFont, txtPlay, (float)fsPlay, 1);
+
+    // Texto centrado en el botón
+    DrawTextEx(
+        PixelFont,
+        txtPlay,
+        { playX + playW / 2 - szPlay.x / 2,
+          playY + playH / 2 - szPlay.y / 2 + 3 },
+        (float)fsPlay, 1, WHITE
+    );
+
+    // Si clickea PLAY → comienza el juego
+    if (CheckCollisionPointRec(mouse, RectPlay) && Pulsado(entrada, ENT_CLICK))
+    {
+        PublicarEvento(Eventos, EV_BOTON_PULSADO, BOTON_PLAY, mouse);
+        Estado = JUGANDO;
+        ReiniciarPartida();
+    }
+
+    // --- DIBUJAR BOTÓN EXIT ---
+    DrawTextureEx(TexturaBoton, { exitX, exitY }, 0, escalaExit, WHITE);
+
+    const char* txtExit = "EXIT";
+    int fsExit = 28;
+    Vector2 szExit = MeasureTextEx(PixelFont, txtExit, (float)fsExit, 1);
+
+    // Texto centrado en el botón
+    DrawTextEx(
+        PixelFont,
+        txtExit,
+        { exitX + exitW / 2 - szExit.x / 2,
+          exitY + exitH / 2 - szExit.y / 2 + 3 },
+        (float)fsExit, 1, WHITE
+    );
+
+    // Si clickea EXIT → cerrar la ventana
+    if (CheckCollisionPointRec(mouse, RectExit) && Pulsado(entrada, ENT_CLICK))
+    {
+        PublicarEvento(Eventos, EV_BOTON_PULSADO, BOTON_EXIT, mouse);
+        salir = true;
+    }
+}
+
+// ============================================================================
+// ESTADO PRINCIPAL DEL JUEGO: JUGANDO
+// ============================================================================
+void Juego::FrameJugando(const EntradaFrame& entrada)
+{
+    InstantaneaPartida anterior;
+
+    // --- Reiniciar la partida (tecla R) ---
+    if (Pulsado(entrada, ENT_REINICIAR))
+    {
+        PublicarEvento(Eventos, EV_BOTON_PULSADO, BOTON_REINICIAR, entrada.Mouse);
+        ReiniciarPartida();
+    }
+    // --- Rebobinar (BACKSPACE): vuelve un tick por frame mientras haya ---
+    else if (Pulsado(entrada, ENT_REBOBINAR) && SacarInstantanea(Rebobinado, anterior))
+    {
+        RestaurarInstantanea(anterior, NivelActual, Jugador, LaPuerta, TiempoJugado);
+        AcumuladoTick = 0.0f;
+
+        // La carrera ya no es la que dicta su entrada: el fantasma sigue al tiempo
+        TicksCarrera = (int)(TiempoJugado / DtTick + 0.5f);
+        CarreraValida = false;
+    }
+    else
+    {
+        // El dt del frame solo decide cuántos ticks fijos corren
+        AcumuladoTick += entrada.Dt;
+        if (AcumuladoTick > MaxTicksPorFrame * DtTick) AcumuladoTick = MaxTicksPorFrame * DtTick;
+
+        // Un salto o un click no se pierden si este frame no llega a un tick
+        const unsigned short Pulsos = ENT_SALTO | ENT_CLICK;
+        PulsosPendientes |= entrada.Botones & Pulsos;
+
+        while (AcumuladoTick >= DtTick && Estado == JUGANDO)
+        {
+            AcumuladoTick -= DtTick;
+
+            EntradaFrame tick = entrada;
+            tick.Botones = (unsigned short)((entrada.Botones & ~Pulsos) | PulsosPendientes);
+            PulsosPendientes = 0;
+
+            if (InicialValida)
+            {
+                InstantaneaPartida* lugar = EmpujarInstantanea(Rebobinado);
+                if (lugar) TomarInstantanea(*lugar, NivelActual, Jugador, LaPuerta, TiempoJugado);
+            }
+
+            ResultadoTick r = SimularTick(NivelActual, Jugador, LaPuerta, TiempoJugado, tick, &Eventos);
+
+            // Una carrera rebobinada ya no puede ser récord: no se sigue
+            // grabando (la reserva alcanza solo para una carrera sin rebobinar)
+            if (CarreraValida)
+            {
+                tick.Dt = DtTick;
+                EntradasCarrera.push_back(tick);
+                GrabarTickFantasma(Trayectoria, Jugador.Fisica, Jugador.Animacion);
+            }
+            TicksCarrera++;
+
+            // --- Condición de victoria (abrir la puerta) ---
+            if (r.Victoria)
+            {
+                Estado = TRANSICION_GANASTE;
+                TemporizadorFinal = 0.0f;
+                TiempoFinal = TiempoJugado;
+            }
+
+            // --- Condiciones de derrota (saltos, tiempo, murciélagos y trampas) ---
+            if (r.Derrota != SIN_PERDIDA)
+            {
+                Motivo = r.Derrota;
+                Estado = TRANSICION_PERDISTE;                   // Lleva a la transicion de pantalla
+                TemporizadorFinal = 0.0f;
+                TiempoFinal = TiempoJugado;
+            }
+
+            // Carrera terminada: al historial (y al récord si ganó)
+            if (Estado != JUGANDO)
+            {
+                Historial::Registrar(NivelActual.Id, TiempoFinal,
+                    Estado == TRANSICION_PERDISTE ? Motivo : SIN_PERDIDA, Jugador.Fisica.ContadorSaltos);
+                if (Estado == TRANSICION_GANASTE) GuardarSiEsRecord();
+            }
+        }
+    }
+
+    // DIBUJADO DEL ESCENARIO BASE
+    EscenarioBase(
+        FondoNivel,
+        TexturaArbol,
+        NivelActual
+    );
+
+    // DIBUJO DE CONTROLES EN PANTALLA
+    DrawTextureEx(TexturaControles1, { 20, 690 }, 0, 0.08f, WHITE);
+
+    if (MostrarControles)
+        DrawTextureEx(TexturaControles2, { 20, 200 }, 0, 0.1f, WHITE);
+
+    // HUD COMPLETO: tiempo, posición, saltos
+    DibujarHUD(
+        PixelFont,
+        TexturaReloj,
+        TexturaPosicion,
+        TexturaSaltos,
+        TiempoJugado,
+        Jugador
+    );
+
+    // ENEMIGOS + JUGADOR + PUERTA (orden correcto de renderizado)
+    DibujarEnemigos(NivelActual.Enemigos, NivelActual.NumEnemigos);
+    LaPuerta.Draw();
+
+    // FANTASMA DE LA MEJOR CARRERA (en el mismo tick que la actual)
+    MuestraFantasma fantasma;
+    if (HayMejor && LeerTickFantasma(Mejor.Trayectoria, LectorMejor, TicksCarrera - 1, fantasma))
+        DibujarFantasma(fantasma, Jugador.Escala, Fade(WHITE, 0.4f));
+
+    Jugador.Draw();
+}
+
+// ============================================================================
+// RÉCORD: la carrera ganada pasa a ser la Mejor si tardó menos
+// ============================================================================
+void Juego::GuardarSiEsRecord()
+{
+    if (!RutaMejorCarrera || !CarreraValida) return;
+    if (HayMejor && TiempoFinal >= Mejor.Tiempo) return;
+
+    // Intercambio: la carrera en curso queda vacía hasta el próximo reinicio
+    Mejor.IdNivel = NivelActual.Id;
+    Mejor.Tiempo = TiempoFinal;
+    Mejor.Entradas.swap(EntradasCarrera);
+    std::swap(Mejor.Trayectoria, Trayectoria);
+    ReiniciarLector(LectorMejor);
+    HayMejor = true;
+
+    if (GuardarMejorCarrera(RutaMejorCarrera, Mejor))
+        TraceLog(LOG_INFO, "FANTASMA: nuevo récord %.2f s (%d ticks, %zu bytes de trayectoria)",
+            Mejor.Tiempo, Mejor.Trayectoria.Ticks, Mejor.Trayectoria.Datos.size());
+}
+
+// ============================================================================
+// ESTADO: TRANSICIÓN HACIA LA PANTALLA DE VICTORIA
+// ============================================================================
+// Esta fase muestra una animación breve antes de pasar a la pantalla GANASTE.
+void Juego::FrameTransicionGanaste(const EntradaFrame& entrada)
+{
+    // Tiempo transcurrido en esta transición
+    TemporizadorFinal += entrada.Dt;
+
+    // --- ESCENARIO COMPLETO DEL NIVEL ---
+    // Se dibuja el fondo, el suelo, los pinchos, plataformas y caja, tal como en
+    // el estado JUGANDO. El jugador NO aparece durante esta transición.
+    EscenarioBase(
+        FondoNivel,
+        TexturaArbol,
+        NivelActual
+    );
+
+    // --- SE DIBUJA ÚNICAMENTE LA PUERTA ---
+    LaPuerta.Draw();    // La puerta permanece visible para reforzar que se activó antes de ganar.
+
+    // --- AVANCE AUTOMÁTICO A LA PANTALLA DE VICTORIA ---
+    if (TemporizadorFinal >= 1.0f)  // Pasados 1.0 segundos, se cambia al estado GANASTE.
+    {
+        Estado = GANASTE;
+        PantallaFijaLista = false;  // El tiempo final cambió: se vuelve a componer
+    }
+}
+
+// ============================================================================
+// PANTALLAS FINALES: COMPOSICIÓN DE LA PARTE FIJA
+// ============================================================================
+// Con RedibujoParcial la parte fija se dibuja una sola vez en PantallaFija
+// (al entrar a la pantalla) y después solo se copia. Sin render texture
+// (o con el modo apagado) se compone directo en pantalla cada frame.
+void Juego::DibujarPantallaFija()
+{
+    if (!RedibujoParcial || PantallaFija.id == 0)
+    {
+        if (Estado == GANASTE) ComponerGanaste();
+        else ComponerPerdiste();
+        return;
+    }
+
+    if (!PantallaFijaLista)
+    {
+        // Begin/EndTextureMode vacían el lote por su cuenta: se vacía antes
+        // para que esas llamadas también se cuenten
+        Instanciado::VaciarLote();
+        BeginTextureMode(PantallaFija);
+        if (Estado == GANASTE) ComponerGanaste();
+        else ComponerPerdiste();
+        Instanciado::VaciarLote();
+        EndTextureMode();
+        PantallaFijaLista = true;
+    }
+
+    // Las render textures quedan invertidas en Y
+    Rectangle fuente = { 0, 0, (float)PantallaFija.texture.width, -(float)PantallaFija.texture.height };
+    DrawTextureRec(PantallaFija.texture, fuente, { 0, 0 }, WHITE);
+}
+
+// Todo GANASTE es fijo: el tiempo final no cambia mientras se muestra
+void Juego::ComponerGanaste()
+{
+    // --- ESCENARIO DE VICTORIA ---
+    // Se dibuja el fondo y un suelo normal (sin pinchos, sin árbol)
+    EscenarioFinalGanaste(
+        TexturaFondo,
+        SueloGanaste
+    );
+
+    // MARCO DECORATIVO DE LA PANTALLA GANADORA
+    float marcoX = (float)(525 - TexturaMarcoFinal.width / 2);
+    float marcoY = 90;
+    DrawTexture(TexturaMarcoFinal, (int)marcoX, (int)marcoY, WHITE);
+
+    // --- TEXTO PRINCIPAL "GANASTE!" ---
+    // Con sombra para darle efecto visual más destacado
+    const char* msg = "GANASTE!";
+    int fontSize = 45;
+    float spacing = 1;
+
+    Vector2 size = MeasureTextEx(PixelFont, msg, (float)fontSize, spacing);
+    float textoX = 525 - size.x / 2;
+    float textoY = marcoY + 185;
+
+    Color AmarilloClaro = { 255, 255, 150, 255 };
+    Color NaranjaOscuro = { 255, 140, 0, 255 };
+
+    DrawTextEx(PixelFont, msg, { textoX, textoY - 3 }, (float)fontSize, spacing, AmarilloClaro);
+    DrawTextEx(PixelFont, msg, { textoX, textoY + 3 }, (float)fontSize, spacing, NaranjaOscuro);
+    DrawTextEx(PixelFont, msg, { textoX, textoY }, (float)fontSize, spacing, YELLOW);
+
+    // TROFEO CENTRAL (solo decorativo)
+    float trofeoX = (float)(512 - TexturaTrofeo.width / 2);
+    float trofeoY = (float)(640 - TexturaTrofeo.height);
+    DrawTexture(TexturaTrofeo, (int)trofeoX, (int)trofeoY, WHITE);
+
+    // DIBUJAR PLAYER PARADO EN LA ESCENA DE VICTORIA (Siempre aparece en la esquina inferior izquierda es decorativo)
+    Vector2 posCab = { 25.0f, 568.0f };
+    DrawTextureEx(Recursos::Textura(Jugador.TexturaCaballero), posCab, 0, Jugador.Escala, WHITE);
+
+    // CUADRO DE DIÁLOGO FINAL — INVERTIDO HORIZONTALMENTE (Acompaña al personaje cuando completa el nivel)
+    float escalaDialogo = 0.40f;
+    const Texture2D& TexturaDialogo = Recursos::Textura(LaPuerta.TextDialogo);
+    float dw = TexturaDialogo.width * escalaDialogo;
+    float dh = TexturaDialogo.height * escalaDialogo;
+
+    Vector2 posDialogo;
+    posDialogo.x = posCab.x - 20;
+    posDialogo.y = posCab.y - dh + 10;
+
+    Rectangle src = {
+        (float)TexturaDialogo.width,  // Volteado
+        0,
+        -(float)TexturaDialogo.width,
+        (float)TexturaDialogo.height
+    };
+
+    Rectangle dst = {
+        posDialogo.x,
+        posDialogo.y,
+        TexturaDialogo.width * escalaDialogo,
+        TexturaDialogo.height * escalaDialogo
+    };
+
+    DrawTexturePro(TexturaDialogo, src, dst, { 0,0 }, 0, WHITE);
+
+    // MENSAJE FINAL (volver al menú)
+    const char* textoFin = "Presiona R para volver al menu";
+    int fs = 8;
+    Vector2 ts = MeasureTextEx(PixelFont, textoFin, (float)fs, 1);
+
+    Vector2 posTexto = {
+        posDialogo.x + dw / 2 - ts.x / 2,
+        posDialogo.y + dh / 2 - ts.y / 2 - 10
+    };
+
+    DrawTextEx(PixelFont, textoFin, posTexto, (float)fs, 1, BLACK);
+
+    // TIEMPO FINAL FORMATEADO (MM:SS)
+    int sFin = (int)TiempoFinal;
+    int cFin = (int)((TiempoFinal - sFin) * 100.0f);
+    if (cFin < 0) cFin = 0;
+    if (cFin > 99) cFin = 99;
+
+    const char* tiempoFinalStr = TextFormat("%02i:%02i", sFin, cFin);
+
+    DrawTextureEx(TexturaReloj, { 810, 10 }, 0, 0.15f, WHITE);
+    DrawTextEx(PixelFont, tiempoFinalStr, { 860, 25 }, 25, 1, BLACK);
+
+    // MEJOR TIEMPO Y PUESTO (si el historial sigue cargando, se recompone al terminar)
+    Historial::Resumen resumen;
+    if (Historial::Consultar(NivelActual.Id, TiempoFinal, resumen) && resumen.Ganadas > 0)
+    {
+        int sMejor = (int)resumen.Mejor;
+        int cMejor = (int)((resumen.Mejor - sMejor) * 100.0f);
+        if (cMejor > 99) cMejor = 99;
+
+        DrawTextEx(PixelFont, TextFormat("MEJOR %02i:%02i", sMejor, cMejor), { 810, 65 }, 12, 1, BLACK);
+        DrawTextEx(PixelFont, TextFormat("PUESTO %i/%i", resumen.Puesto, resumen.Ganadas), { 810, 85 }, 12, 1, BLACK);
+    }
+    ResumenCompleto = resumen.Completo;
+}
+
+// ============================================================================
+// ESTADO: PANTALLA DE LA VICTORIA
+// ============================================================================
+void Juego::FrameGanaste(const EntradaFrame& entrada)
+{
+    // El historial terminó de cargar después de componer: mejor y puesto cambian
+    if (PantallaFijaLista && !ResumenCompleto && Historial::Completo())
+        PantallaFijaLista = false;
+
+    // Fondo, suelo, marco, textos, trofeo, caballero, diálogo, tiempo final, mejor y puesto
+    DibujarPantallaFija();
+
+    // REINICIAR DESDE LA PANTALLA DE GANASTE (R vuelve al menú principal y reinicia entidades)
+    if (Pulsado(entrada, ENT_REINICIAR))
+    {
+        PublicarEvento(Eventos, EV_BOTON_PULSADO, BOTON_REINICIAR, entrada.Mouse);
+        Estado = MENU;
+        ReiniciarPartida();
+    }
+}
+
+// ============================================================================
+// ESTADO: TRANSICIÓN A PANTALLA DE DERROTA
+// ============================================================================
+// Esta fase muestra el escenario estático durante 1 segundo antes de pasar a la pantalla PERDISTE.
+// La puerta se fuerza a estar cerrada y el jugador NO se dibuja (para reforzar el impacto visual de la derrota).
+void Juego::FrameTransicionPerdiste(const EntradaFrame& entrada)
+{
+    TemporizadorFinal += entrada.Dt;    // Avanzamos la cuenta para la transición
+
+    // --- ESCENARIO COMPLETO (fondo + suelo + pinchos + plataformas + caja) ---
+    // Se usa el mismo escenario base del juego, pero congelado y sin jugador.
+    EscenarioBase(
+        FondoNivel,
+        TexturaArbol,
+        NivelActual
+    );
+
+    // --- PUERTA FORZADA A ESTAR CERRADA ---
+    LaPuerta.EstaAbierta = false;   // Durante esta transición la puerta nunca debe abrirse
+    LaPuerta.Draw();
+
+    // --- AVANZAMOS A LA PANTALLA PERDISTE LUEGO DE 1 SEGUNDO ---
+    if (TemporizadorFinal >= 1.0f)
+    {
+        Estado = PERDISTE;
+        PantallaFijaLista = false;  // El motivo cambió: se vuelve a componer
+    }
+}
+
+// ============================================================================
+// ESTADO: PERDISTE
+// ============================================================================
+// Se ejecuta cuando el jugador pierde por cualquiera de los motivos:
+// tiempo agotado, exceso de saltos, colisión con pinchos o con murciélagos.
+// Muestra cartel, motivo y botones para reintentar o ir al menú.
+// ============================================================================
+
+// Parte fija: escenario, cartel, motivo y texto de los botones
+void Juego::ComponerPerdiste()
+{
+    // --- ESCENARIO PERDISTE ---
+    // El fondo se mantiene igual, el suelo completo es remplazado por pinchos decorativos.
+    EscenarioFinalPerdiste(
+        TexturaFondo,
+        SueloPerdiste
+    );
+
+    // --- MARCO Y TEXTO "PERDISTE" ---
+    float marcoX = (float)(525 - TexturaMarcoPerdiste.width / 2);
+    float marcoY = 10;
+    DrawTexture(TexturaMarcoPerdiste, (int)marcoX, (int)marcoY, WHITE);
+
+    const char* msg = "PERDISTE";
+    int fontSize = 40;
+    float spacing = 1;
+
+    Vector2 size = MeasureTextEx(PixelFont, msg, (float)fontSize, spacing);
+
+    float textoX = 520 - size.x / 2;
+    float textoY = marcoY + 185;
+
+    // Colores con sombras para efecto visual
+    Color RojoSombra = { 120, 0, 0, 255 };
+    Color RojoLuz = { 255, 180, 180, 255 };
+    Color RojoPrincipal = { 255, 50, 50, 255 };
+
+    DrawTextEx(PixelFont, msg, { textoX, textoY + 3 }, (float)fontSize, spacing, RojoSombra);
+    DrawTextEx(PixelFont, msg, { textoX, textoY - 3 }, (float)fontSize, spacing, RojoLuz);
+    DrawTextEx(PixelFont, msg, { textoX, textoY }, (float)fontSize, spacing, RojoPrincipal);
+
+
+    // --- MOTIVO DE LA DERROTA (dependiendo del tipo de pérdida) ---
+    const char* msgMotivo = "";
+
+    if (Motivo == PERDIDA_SALTOS)          msgMotivo = "Saltaste demasiado!";
+    else if (Motivo == PERDIDA_TIEMPO)     msgMotivo = "Te quedaste sin tiempo!";
+    else if (Motivo == PERDIDA_MURCIELAGO) msgMotivo = "Te mordio un murcielago!";
+    else if (Motivo == PERDIDA_PINCHOS)    msgMotivo = "Caiste en las trampas!";
+
+    int fontMotivo = 18;
+    Vector2 sizeMotivo = MeasureTextEx(PixelFont, msgMotivo, (float)fontMotivo, 1);
+
+    float motivoX = 512 - sizeMotivo.x / 2;
+    float motivoY = textoY + 110;
+
+    DrawTextEx(PixelFont, msgMotivo, { motivoX, motivoY }, (float)fontMotivo, 1, BLACK);
+
+
+    // --- BOTONES: REINTENTAR y MENU ---
+    const char* tRetry = "REINTENTAR";
+    const char* tMenu = "MENU";
+
+    float fontBoton = 22;
+
+    // Posiciones centradas
+    PosRetry = {
+        512 - MeasureTextEx(PixelFont, tRetry, fontBoton, 1).x / 2,
+        420
+    };
+
+    PosMenu = {
+        512 - MeasureTextEx(PixelFont, tMenu, fontBoton, 1).x / 2,
+        470
+    };
+
+    // Dibujar texto de botones
+    DrawTextEx(PixelFont, tRetry, PosRetry, fontBoton, 1, BLACK);
+    DrawTextEx(PixelFont, tMenu, PosMenu, fontBoton, 1, BLACK);
+}
+
+void Juego::FramePerdiste(const EntradaFrame& entrada)
+{
+    // Escenario, cartel, motivo y botones (también mide PosRetry / PosMenu)
+    DibujarPantallaFija();
+
+    // rectRetry - rectMenu definen las áreas clickeables
+    Rectangle rectRetry = { PosRetry.x, PosRetry.y, 250, 35 };
+    Rectangle rectMenu = { PosMenu.x,  PosMenu.y,  250, 35 };
+
+    Vector2 mouse = entrada.Mouse;
+
+    bool hoverRetry = CheckCollisionPointRec(mouse, rectRetry);
+    bool hoverMenu = CheckCollisionPointRec(mouse, rectMenu);
+
+    // Evento al entrar por primera vez al hover de cada botón
+    if (hoverRetry && !HoverRetryPrev) PublicarEvento(Eventos, EV_BOTON_ENCIMA, BOTON_REINTENTAR, mouse);
+    if (hoverMenu && !HoverMenuPrev) PublicarEvento(Eventos, EV_BOTON_ENCIMA, BOTON_MENU, mouse);
+
+    // Guardar estados del frame anterior
+    HoverRetryPrev = hoverRetry;
+    HoverMenuPrev = hoverMenu;
+
+    // Flecha animada cuando el mouse pasa por encima
+    if (hoverRetry)
+    {
+        float escF = 0.25f;
+        float fx = PosRetry.x - (TexturaFlecha.width * escF) - 10;
+        float fy = PosRetry.y - 2;
+        DrawTextureEx(TexturaFlecha, { fx, fy }, 0, escF, WHITE);
+    }
+
+    if (hoverMenu)
+    {
+        float escF = 0.25f;
+        float fx = PosMenu.x - (TexturaFlecha.width * escF) - 10;
+        float fy = PosMenu.y - 2;
+        DrawTextureEx(TexturaFlecha, { fx, fy }, 0, escF, WHITE);
+    }
+
+
+    // --- ACCIONES DE BOTONES ---
+    // → REINTENTAR: Reinicia jugador, murciélagos y estado
+    if (hoverRetry && Pulsado(entrada, ENT_CLICK))
+    {
+        PublicarEvento(Eventos, EV_BOTON_PULSADO, BOTON_REINTENTAR, mouse);
+        ReiniciarPartida();
+        Estado = JUGANDO;
+    }
+
+    // → VOLVER AL MENU
+    if (hoverMenu && Pulsado(entrada, ENT_CLICK))
+    {
+        PublicarEvento(Eventos, EV_BOTON_PULSADO, BOTON_MENU, mouse);
+        ReiniciarPartida();
+        Estado = MENU;
+    }
+}
@@ -0,0 +1,191 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Player.hpp"       // Lógica y render del jugador
+#include "Puerta.hpp"       // Objeto que define el final del nivel
+#include "Arena.hpp"        // Memoria lineal que respalda los datos de cada nivel
+#include "Nivel.hpp"        // Plataformas, cajas, murciélagos y colisionadores del nivel
+#include "Reglas.hpp"       // Límites de saltos/tiempo y condiciones de derrota
+#include "Entrada.hpp"      // Entrada de cada frame (teclado o grabación)
+#include "Instantanea.hpp"  // Copia del estado de la partida (reinicio y rebobinado)
+#include "Simulacion.hpp"   // Tick fijo y determinista de la partida
+#include "Fantasma.hpp"     // Mejor carrera y su fantasma
+#include "Historial.hpp"    // Carreras terminadas (mejor tiempo y puesto)
+#include "Eventos.hpp"      // Lo que pasó en el frame (sonidos y demás efectos)
+#include "Parallax.hpp"     // Fondo del nivel en capas
+
+// ============================================================================
+// ESTADOS DEL JUEGO
+// ============================================================================
+// Representan las diferentes pantallas y transiciones del flujo general:
+// - MENU: pantalla principal con botones
+// - JUGANDO: loop principal de juego
+// - TRANSICION_GANASTE → GANASTE: animación + pantalla final de victoria
+// - TRANSICION_PERDISTE → PERDISTE: animación + pantalla final de derrota
+// ============================================================================
+enum EstadoJuego { MENU, JUGANDO, TRANSICION_GANASTE, GANASTE, TRANSICION_PERDISTE, PERDISTE};
+
+// ============================================================================
+// CLASE JUEGO
+// ============================================================================
+// Todo lo que antes vivía suelto en main(): texturas de las pantallas,
+// estado de la partida, jugador, puerta y nivel.
+// Cada llamada a Frame() actualiza y dibuja un frame a partir de una
+// EntradaFrame, sin leer el teclado ni el reloj: el mismo código corre
+// con la ventana normal, con una grabación o dentro del arnés de
+// regresión de frames. BeginDrawing/EndDrawing quedan a cargo de quien llama.
+// ============================================================================
+class Juego
+{
+public:
+    // ========================================================================
+    // TEXTURAS DE LAS PANTALLAS (las de las entidades están en Recursos)
+    // ========================================================================
+    Texture2D TexturaFondo;             // Fondo general del nivel
+    Texture2D TexturaBoton;             // Botón base reutilizado para el menú
+    Texture2D TexturaTrofeo;            // Trofeo mostrado al ganar
+    Texture2D TexturaMarcoFinal;        // Marco decorativo para la pantalla de victoria
+    Texture2D TexturaControles1;        // Controles, HUD y elementos decorativos
+    Texture2D TexturaControles2;
+    Texture2D TexturaReloj;
+    Texture2D TexturaPosicion;
+    Texture2D TexturaArbol;
+    Texture2D TexturaMarcoPerdiste;
+    Texture2D TexturaFlecha;
+    Texture2D TexturaSaltos;
+
+    Font PixelFont;                     // Fuente pixelada para textos del HUD y menú
+
+    // Fondo del nivel en capas de parallax (usa TexturaFondo; no es dueño)
+    FondoParallax FondoNivel;
+
+    // ========================================================================
+    // ESTADO GENERAL
+    // ========================================================================
+    EstadoJuego Estado;                 // Menú, jugando, transiciones, etc.
+    bool MostrarControles;              // Alternar la visualización de controles con la tecla M
+    float TiempoJugado;                 // Acumula el tiempo de la partida actual
+    float TiempoFinal;                  // Guarda el tiempo logrado cuando se gana o pierde
+    float TemporizadorFinal;            // Temporizador usado en pantallas de transición
+    MotivoPerdida Motivo;               // Identifica la causa de la derrota
+
+    // Tick fijo: tiempo real todavía no simulado y los flancos (salto,
+    // click) de frames que no llegaron a correr un tick
+    float AcumuladoTick;
+    unsigned short PulsosPendientes;
+
+    // Eventos del frame: los publican la simulación y las pantallas, y se
+    // consumen todos juntos al final de Frame()
+    ColaEventos Eventos;
+
+    // Estados previos del hover, usados para publicar EV_BOTON_ENCIMA solo una vez
+    bool HoverPlayPrev;
+    bool HoverExitPrev;
+    bool HoverRetryPrev;
+    bool HoverMenuPrev;
+
+    // Rectángulos interactivos del botón PLAY y EXIT
+    Rectangle RectPlay;
+    Rectangle RectExit;
+
+    // Cálculo dinámico de cuántos tiles se necesitan para cubrir el ancho
+    int TilesNecesarios;
+
+    // Filas de tiles decorativas de las pantallas finales (suelo entero o
+    // pinchos enteros); viven en su propia arena, no en la del nivel
+    ArenaNivel ArenaPantallas;
+    CapaTiles SueloGanaste;
+    CapaTiles SueloPerdiste;
+
+    // ========================================================================
+    // PANTALLAS FINALES COMPUESTAS UNA SOLA VEZ
+    // ========================================================================
+    // Casi nada de GANASTE y PERDISTE cambia mientras están abiertas: la
+    // parte fija se compone una vez en PantallaFija y cada frame solo se
+    // copia esa textura (un quad) y se dibuja lo que cambia (la flecha del
+    // botón bajo el mouse). Se vuelve a componer al entrar a la pantalla.
+    bool RedibujoParcial;               // false: se recompone todo en cada frame (como antes)
+    RenderTexture2D PantallaFija;
+    bool PantallaFijaLista;
+    Vector2 PosRetry;                   // Botones de PERDISTE (se miden al componer)
+    Vector2 PosMenu;
+    bool ResumenCompleto;               // GANASTE se compuso con el historial ya cargado
+
+    // ========================================================================
+    // ENTIDADES Y NIVEL
+    // ========================================================================
+    Player Jugador;
+    Puerta LaPuerta;
+    ArenaNivel Arena;                   // Bloque único de memoria para el nivel actual
+    Nivel NivelActual;
+    const DisenoNivel* Desafio;         // Nivel generado a jugar (nullptr: el nivel 1)
+    int IdDesafio;
+
+    // Estado de la partida recién cargado el nivel: reiniciar es copiarlo
+    InstantaneaPartida Inicial;
+    bool InicialValida;                 // false si el nivel no entra en una instantánea
+
+    // Últimos frames jugados (BACKSPACE vuelve de a uno)
+    AnilloInstantaneas Rebobinado;
+
+    // ========================================================================
+    // MEJOR CARRERA Y FANTASMA
+    // ========================================================================
+    // La carrera en curso se graba tick a tick (entrada + trayectoria). Si
+    // gana con mejor tiempo pasa a ser la Mejor y se guarda en el archivo;
+    // la Mejor se dibuja como un caballero translúcido en el mismo tick.
+    const char* RutaMejorCarrera;       // nullptr: sin récord ni fantasma
+    MejorCarrera Mejor;
+    bool HayMejor;
+    LectorFantasma LectorMejor;
+
+    TrayectoriaFantasma Trayectoria;    // Carrera en curso
+    std::vector<EntradaFrame> EntradasCarrera;
+    int TicksCarrera;
+    bool CarreraValida;                 // false si se rebobinó: no puede ser récord
+
+    // ========================================================================
+    // MÉTODOS PRINCIPALES
+    // ========================================================================
+    Juego();    // Requiere Recursos::Cargar (el jugador y la puerta miden sus sprites)
+
+    // Archivo de la mejor carrera (va antes de Iniciar). Sin llamarla no
+    // se lee ni se escribe nada y no hay fantasma.
+    void UsarMejorCarrera(const char* ruta);
+
+    // Nivel generado (desafío) en lugar del nivel 1; va antes de Iniciar.
+    // El diseño tiene que seguir vivo mientras dure el Juego.
+    void UsarDesafio(int id, const DisenoNivel& diseno);
+
+    // Carga texturas, fuente y el nivel 1. Requiere la ventana abierta.
+    bool Iniciar();
+
+    // Libera todo lo que cargó Iniciar()
+    void Liberar();
+
+    // Actualiza y dibuja un frame. Devuelve false si se eligió EXIT.
+    bool Frame(const EntradaFrame& entrada);
+
+    // true en las pantallas que no cambian solas (MENU, GANASTE, PERDISTE):
+    // solo responden a la entrada, así que pueden ir a pocos frames por segundo
+    bool PantallaQuieta() const;
+
+private:
+    void FrameMenu(const EntradaFrame& entrada, bool& salir);
+    void FrameJugando(const EntradaFrame& entrada);
+    void FrameTransicionGanaste(const EntradaFrame& entrada);
+    void FrameGanaste(const EntradaFrame& entrada);
+    void FrameTransicionPerdiste(const EntradaFrame& entrada);
+    void FramePerdiste(const EntradaFrame& entrada);
+
+    // Sistemas que reaccionan a los eventos del frame
+    void ConsumirEventos();
+
+    // Parte fija de cada pantalla final y su copia en PantallaFija
+    void GuardarSiEsRecord();
+    void ComponerGanaste();
+    void ComponerPerdiste();
+    void DibujarPantallaFija();
+
+    // Jugador, nivel, puerta y tiempo a su estado inicial
+    void ReiniciarPartida();
+};
@@ -0,0 +1,34 @@
+﻿#include "MemoriaProceso.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+
+size_t MemoriaProceso()
+{
+    PROCESS_MEMORY_COUNTERS_EX c = {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), (PROCESS_MEMORY_COUNTERS*)&c, sizeof(c)))
+        return 0;
+    return c.PrivateUsage;
+}
+
+#else
+#include <cstdio>
+#include <unistd.h>
+
+size_t MemoriaProceso()
+{
+    // /proc/self/statm: tamaño total y residente, en páginas
+    FILE* f = std::fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+
+    unsigned long total = 0, residente = 0;
+    int leidos = std::fscanf(f, "%lu %lu", &total, &residente);
+    std::fclose(f);
+
+    return leidos == 2 ? (size_t)residente * (size_t)sysconf(_SC_PAGESIZE) : 0;
+}
+
+#endif
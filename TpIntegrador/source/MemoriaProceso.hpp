@@ -0,0 +1,14 @@
+﻿#pragma once
+#include <cstddef>
+
+// ============================================================================
+// MEMORIA DEL PROCESO
+// ============================================================================
+// Bytes que el sistema tiene asignados al proceso: en Windows la memoria
+// privada comprometida (lo que crece con una fuga del heap), en Linux el
+// conjunto residente. 0 si no se pudo consultar.
+//
+// Va en su propio archivo porque windows.h choca con los nombres de
+// raylib.h (Rectangle, CloseWindow, DrawText...): este .cpp no incluye raylib.
+// ============================================================================
+size_t MemoriaProceso();
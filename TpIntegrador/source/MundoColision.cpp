@@ -0,0 +1,331 @@
+﻿#include "MundoColision.hpp"
+#include "raylib.h"
+#include <cmath>
+
+// ============================================================================
+// CELDAS DE LA GRILLA
+// ============================================================================
+// Celda a lo largo de un eje, con 'd' ya medido en celdas desde el origen.
+// Lo que cae fuera se asigna a la celda del borde: los índices siguen
+// siendo correctos, solo se comparten más candidatos. Como lo que queda
+// antes del origen ya va a la celda 0, alcanza con truncar (sin floor).
+static int Indice(float d, int celdas)
+{
+    if (d <= 0) return 0;
+    int c = (int)d;
+    return c >= celdas ? celdas - 1 : c;
+}
+
+static unsigned int Columna(const MundoColision& m, float x)
+{
+    return Indice((x - m.Origen.x) * m.InvLadoCelda, m.Columnas);
+}
+
+static unsigned int Fila(const MundoColision& m, float y)
+{
+    return Indice((y - m.Origen.y) * m.InvLadoCelda, m.Filas);
+}
+
+// Rango de celdas empaquetado, 16 bits por borde (X0 | Y0 << 16 | X1 << 32
+// | Y1 << 48). Los 32 bits de abajo son la primera celda (MundoColision::Celdas).
+static unsigned long long RangoCeldas(const MundoColision& m, const Rectangle& r)
+{
+    return (unsigned long long)Columna(m, r.x) | (unsigned long long)Fila(m, r.y) << 16 |
+        (unsigned long long)Columna(m, r.x + r.width) << 32 | (unsigned long long)Fila(m, r.y + r.height) << 48;
+}
+
+static int X0(unsigned long long rango) { return (int)(rango & 0xFFFF); }
+static int Y0(unsigned long long rango) { return (int)((rango >> 16) & 0xFFFF); }
+static int X1(unsigned long long rango) { return (int)((rango >> 32) & 0xFFFF); }
+static int Y1(unsigned long long rango) { return (int)(rango >> 48); }
+
+// Celda (índice lineal en la grilla de dinámicos) de la esquina superior izquierda
+static unsigned int CeldaDinamica(const MundoColision& m, const Rectangle& r)
+{
+    return Indice((r.y - m.OrigenDinamico.y) * m.InvLadoCelda, m.FilasDinamicas) * m.ColumnasDinamicas +
+        Indice((r.x - m.OrigenDinamico.x) * m.InvLadoCelda, m.ColumnasDinamicas);
+}
+
+// ============================================================================
+// ARMADO DE LAS GRILLAS (inicio por celda + lista de índices)
+// ============================================================================
+// Estáticos: dos pasadas sobre sus rangos de celdas; cuenta cuántos
+// índices caen en cada celda, acumula los inicios y después reparte.
+static void ArmarGrilla(const MundoColision& mundo, int desde, int hasta, int* inicio, int* indices)
+{
+    const int columnas = mundo.Columnas;
+    const int celdas = columnas * mundo.Filas;
+    int* cursor = mundo.Cursor;
+
+    for (int c = 0; c < celdas; c++) cursor[c] = 0;
+
+    for (int i = desde; i < hasta; i++)
+    {
+        unsigned long long c = RangoCeldas(mundo, mundo.Rects[i]);
+        for (int y = Y0(c); y <= Y1(c); y++)
+            for (int x = X0(c); x <= X1(c); x++)
+                cursor[y * columnas + x]++;
+    }
+
+    inicio[0] = 0;
+    for (int c = 0; c < celdas; c++)
+    {
+        inicio[c + 1] = inicio[c] + cursor[c];
+        cursor[c] = inicio[c];
+    }
+
+    for (int i = desde; i < hasta; i++)
+    {
+        unsigned long long c = RangoCeldas(mundo, mundo.Rects[i]);
+        for (int y = Y0(c); y <= Y1(c); y++)
+            for (int x = X0(c); x <= X1(c); x++)
+                indices[cursor[y * columnas + x]++] = i;
+    }
+}
+
+// Los dinámicos van en una sola celda (la de su esquina superior izquierda):
+// una pasada sin bucles anidados, porque se rearma mientras el juego corre.
+// La consulta compensa mirando MargenDinamico celdas más hacia atrás.
+static void ArmarGrillaDinamica(MundoColision& mundo)
+{
+    const int celdas = mundo.ColumnasDinamicas * mundo.FilasDinamicas;
+    int* cursor = mundo.Cursor;
+    int* inicio = mundo.InicioDinamico;
+
+    for (int c = 0; c < celdas; c++) cursor[c] = 0;
+
+    for (int i = mundo.NumEstaticos; i < mundo.Num; i++)
+        cursor[mundo.Celdas[i]]++;
+
+    inicio[0] = 0;
+    for (int c = 0; c < celdas; c++)
+    {
+        inicio[c + 1] = inicio[c] + cursor[c];
+        cursor[c] = inicio[c];
+    }
+
+    for (int i = mundo.NumEstaticos; i < mundo.Num; i++)
+        mundo.IndicesDinamicos[cursor[mundo.Celdas[i]]++] = i;
+}
+
+// Origen, tamaño de celda y celdas por lado a partir de los límites de
+// todo lo cargado (estáticos y dinámicos en su lugar de aparición), más
+// una celda vacía de cada lado: una consulta fuera del nivel cae en el
+// borde y no encuentra nada. Las celdas quedan alineadas a múltiplos de su
+// lado, y el lado se agranda al doble hasta que la grilla entra en
+// MaxCeldas.
+static void DimensionarGrilla(MundoColision& mundo)
+{
+    float x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    for (int i = 0; i < mundo.Num; i++)
+    {
+        const Rectangle& r = mundo.Rects[i];
+        if (i == 0 || r.x < x0) x0 = r.x;
+        if (i == 0 || r.y < y0) y0 = r.y;
+        if (i == 0 || r.x + r.width > x1) x1 = r.x + r.width;
+        if (i == 0 || r.y + r.height > y1) y1 = r.y + r.height;
+    }
+
+    float lado = TamCelda;
+    for (;;)
+    {
+        mundo.Origen = { std::floor(x0 / lado) * lado - lado, std::floor(y0 / lado) * lado - lado };
+        mundo.Columnas = (int)((x1 - mundo.Origen.x) / lado) + 2;
+        mundo.Filas = (int)((y1 - mundo.Origen.y) / lado) + 2;
+        if ((long long)mundo.Columnas * mundo.Filas <= MaxCeldas) break;
+        lado *= 2;
+    }
+
+    mundo.LadoCelda = lado;
+    mundo.InvLadoCelda = 1.0f / lado;
+}
+
+// La grilla de dinámicos son las celdas de la grilla principal donde
+// aparecen (por su esquina superior izquierda), con una más de cada lado.
+// Sin dinámicos queda una sola celda.
+static void DimensionarGrillaDinamica(MundoColision& mundo)
+{
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    for (int i = mundo.NumEstaticos; i < mundo.Num; i++)
+    {
+        int x = Columna(mundo, mundo.Rects[i].x);
+        int y = Fila(mundo, mundo.Rects[i].y);
+        if (i == mundo.NumEstaticos || x < x0) x0 = x;
+        if (i == mundo.NumEstaticos || y < y0) y0 = y;
+        if (i == mundo.NumEstaticos || x > x1) x1 = x;
+        if (i == mundo.NumEstaticos || y > y1) y1 = y;
+    }
+
+    if (mundo.Num == mundo.NumEstaticos)
+    {
+        mundo.OrigenDinamico = mundo.Origen;
+        mundo.ColumnasDinamicas = mundo.FilasDinamicas = 1;
+        return;
+    }
+
+    mundo.OrigenDinamico = { mundo.Origen.x + (x0 - 1) * mundo.LadoCelda, mundo.Origen.y + (y0 - 1) * mundo.LadoCelda };
+    mundo.ColumnasDinamicas = x1 - x0 + 3;
+    mundo.FilasDinamicas = y1 - y0 + 3;
+}
+
+// ============================================================================
+// RESERVA Y ARMADO
+// ============================================================================
+bool ReservarMundo(MundoColision& mundo, ArenaNivel& arena, int numEstaticos, int numDinamicos)
+{
+    mundo = {};
+    mundo.Num = numEstaticos + numDinamicos;
+    mundo.NumEstaticos = numEstaticos;
+
+    mundo.Rects = arena.ReservarArreglo<Rectangle>(mundo.Num);
+    mundo.Etiquetas = arena.ReservarArreglo<unsigned char>(mundo.Num);
+    mundo.Datos = arena.ReservarArreglo<unsigned char>(mundo.Num);
+    mundo.Celdas = arena.ReservarArreglo<unsigned int>(mundo.Num);
+    mundo.Desplazamientos = arena.ReservarArreglo<Vector2>(numDinamicos);
+
+    return (mundo.Num == 0 || (mundo.Rects && mundo.Etiquetas && mundo.Datos && mundo.Celdas)) &&
+        (numDinamicos == 0 || mundo.Desplazamientos);
+}
+
+bool IndexarMundo(MundoColision& mundo, ArenaNivel& arena)
+{
+    DimensionarGrilla(mundo);
+    DimensionarGrillaDinamica(mundo);
+    const int celdas = mundo.Columnas * mundo.Filas;
+    const int celdasDinamicas = mundo.ColumnasDinamicas * mundo.FilasDinamicas;
+
+    // --- Estáticos: se cuentan las celdas que ocupan y se arma la grilla ---
+    int totalEstatico = 0;
+    for (int i = 0; i < mundo.NumEstaticos; i++)
+    {
+        unsigned long long c = RangoCeldas(mundo, mundo.Rects[i]);
+        mundo.Celdas[i] = (unsigned int)c;
+        totalEstatico += (X1(c) - X0(c) + 1) * (Y1(c) - Y0(c) + 1);
+    }
+
+    mundo.InicioEstatico = arena.ReservarArreglo<int>(celdas + 1);
+    mundo.IndicesEstaticos = arena.ReservarArreglo<int>(totalEstatico);
+
+    // --- Dinámicos: el más grande define cuántas celdas hacia atrás puede asomar ---
+    float mayor = 0;
+    for (int i = mundo.NumEstaticos; i < mundo.Num; i++)
+    {
+        if (mundo.Rects[i].width > mayor) mayor = mundo.Rects[i].width;
+        if (mundo.Rects[i].height > mayor) mayor = mundo.Rects[i].height;
+        mundo.Celdas[i] = CeldaDinamica(mundo, mundo.Rects[i]);
+    }
+    mundo.MargenDinamico = (int)(mayor * mundo.InvLadoCelda) + 1;
+
+    mundo.InicioDinamico = arena.ReservarArreglo<int>(celdasDinamicas + 1);
+    mundo.IndicesDinamicos = arena.ReservarArreglo<int>(mundo.Num - mundo.NumEstaticos);
+    mundo.Cursor = arena.ReservarArreglo<int>(celdas > celdasDinamicas ? celdas : celdasDinamicas);
+
+    if (!mundo.InicioEstatico || !mundo.InicioDinamico || !mundo.Cursor ||
+        (totalEstatico > 0 && !mundo.IndicesEstaticos) ||
+        (mundo.Num > mundo.NumEstaticos && !mundo.IndicesDinamicos))
+        return false;
+
+    ArmarGrilla(mundo, 0, mundo.NumEstaticos, mundo.InicioEstatico, mundo.IndicesEstaticos);
+    ArmarGrillaDinamica(mundo);
+    return true;
+}
+
+void ActualizarDinamicos(MundoColision& mundo)
+{
+    bool cambio = false;
+
+    for (int i = mundo.NumEstaticos; i < mundo.Num; i++)
+    {
+        unsigned int c = CeldaDinamica(mundo, mundo.Rects[i]);
+        cambio |= c != mundo.Celdas[i];
+        mundo.Celdas[i] = c;
+    }
+
+    if (cambio)
+        ArmarGrillaDinamica(mundo);
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+// Un estático grande aparece en varias celdas. Para no devolverlo dos veces
+// solo se acepta en la celda donde empieza la intersección entre su rango
+// de celdas y el de la consulta. Los dinámicos están en una sola celda.
+static int RecorrerEstaticos(const MundoColision& mundo, int celdaX, int celdaY, unsigned long long consulta,
+                             const Rectangle& rect, unsigned char mascara,
+                             int* salida, int cantidad, int maximo)
+{
+    int celda = celdaY * mundo.Columnas + celdaX;
+
+    for (int k = mundo.InicioEstatico[celda]; k < mundo.InicioEstatico[celda + 1] && cantidad < maximo; k++)
+    {
+        int i = mundo.IndicesEstaticos[k];
+        if (!(mundo.Etiquetas[i] & mascara)) continue;
+
+        unsigned int c = mundo.Celdas[i];
+        if (celdaX != (X0(c) > X0(consulta) ? X0(c) : X0(consulta))) continue;
+        if (celdaY != (Y0(c) > Y0(consulta) ? Y0(c) : Y0(consulta))) continue;
+
+        if (CheckCollisionRecs(rect, mundo.Rects[i]))
+            salida[cantidad++] = i;
+    }
+
+    return cantidad;
+}
+
+static int RecorrerDinamicos(const MundoColision& mundo, int celda, const Rectangle& rect,
+                             unsigned char mascara, int* salida, int cantidad, int maximo)
+{
+    for (int k = mundo.InicioDinamico[celda]; k < mundo.InicioDinamico[celda + 1] && cantidad < maximo; k++)
+    {
+        int i = mundo.IndicesDinamicos[k];
+        if ((mundo.Etiquetas[i] & mascara) && CheckCollisionRecs(rect, mundo.Rects[i]))
+            salida[cantidad++] = i;
+    }
+
+    return cantidad;
+}
+
+int ConsultarMundo(const MundoColision& mundo, Rectangle rect, unsigned char mascara,
+                   int* salida, int maximo)
+{
+    if (mundo.Num == 0) return 0;
+
+    unsigned long long consulta = RangoCeldas(mundo, rect);
+    int cantidad = 0;
+
+    for (int y = Y0(consulta); y <= Y1(consulta); y++)
+        for (int x = X0(consulta); x <= X1(consulta); x++)
+            cantidad = RecorrerEstaticos(mundo, x, y, consulta, rect, mascara, salida, cantidad, maximo);
+
+    if (mundo.Num > mundo.NumEstaticos)
+    {
+        // Celdas de la consulta en la grilla de dinámicos, con el margen
+        const Vector2 origen = mundo.OrigenDinamico;
+        int x0 = Indice((rect.x - origen.x) * mundo.InvLadoCelda, mundo.ColumnasDinamicas) - mundo.MargenDinamico;
+        int y0 = Indice((rect.y - origen.y) * mundo.InvLadoCelda, mundo.FilasDinamicas) - mundo.MargenDinamico;
+        int x1 = Indice((rect.x + rect.width - origen.x) * mundo.InvLadoCelda, mundo.ColumnasDinamicas);
+        int y1 = Indice((rect.y + rect.height - origen.y) * mundo.InvLadoCelda, mundo.FilasDinamicas);
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+
+        for (int y = y0; y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                cantidad = RecorrerDinamicos(mundo, y * mundo.ColumnasDinamicas + x, rect, mascara, salida, cantidad, maximo);
+    }
+
+    // Orden de carga: quien consulta resuelve en el mismo orden siempre
+    for (int i = 1; i < cantidad; i++)
+    {
+        int v = salida[i];
+        int j = i - 1;
+        while (j >= 0 && salida[j] > v)
+        {
+            salida[j + 1] = salida[j];
+            j--;
+        }
+        salida[j + 1] = v;
+    }
+
+    return cantidad;
+}
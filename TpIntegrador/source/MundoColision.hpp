@@ -0,0 +1,110 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Arena.hpp"
+
+// ============================================================================
+// ETIQUETAS DE COLISIÓN
+// ============================================================================
+// Cada colisionador del nivel lleva una etiqueta. Las consultas reciben una
+// máscara (combinación de etiquetas) y solo devuelven lo que coincide.
+// ============================================================================
+enum EtiquetaColision : unsigned char
+{
+    COL_SOLIDO = 1 << 0,        // Bloquea de costado y se puede pisar (plataformas, cajas)
+    COL_UNA_VIA = 1 << 1,       // Solo se pisa desde arriba; de costado y desde abajo no existe
+    COL_PELIGRO = 1 << 2,       // Trampas del escenario (pinchos)
+    COL_DISPARADOR = 1 << 3,    // Zonas que avisan al tocarlas (puerta)
+    COL_ENEMIGO = 1 << 4        // Enemigos en movimiento (murciélagos)
+};
+
+// ============================================================================
+// MUNDO DE COLISIÓN
+// ============================================================================
+// Todos los colisionadores del nivel en arreglos paralelos (Rects,
+// Etiquetas, Datos). 'Dato' depende de la etiqueta:
+//   - COL_SOLIDO / COL_UNA_VIA  -> TipoSuelo de la superficie
+//   - COL_PELIGRO / COL_ENEMIGO -> MotivoPerdida al tocarlo
+//   - COL_DISPARADOR            -> identificador del disparador
+//
+// Los primeros NumEstaticos no se mueven nunca; los siguientes son
+// dinámicos y se vuelven a ubicar con ActualizarDinamicos() cada tick.
+//
+// Fase amplia: grilla uniforme de celdas de TamCelda px. Cada celda guarda
+// los índices que la tocan, en formato compacto (inicio por celda + lista),
+// una grilla para los estáticos (se arma una vez) y otra para los
+// dinámicos, que van solo en la celda de su esquina y se rearma si alguno
+// cambió de celda. Una consulta solo
+// mira las celdas que toca el rectángulo, así que cuesta O(candidatos) y
+// no O(colisionadores). Todo vive en la ArenaNivel.
+//
+// La grilla cubre los límites del nivel (todo lo cargado al indexar) con
+// una celda vacía de margen alrededor. Lo que después se mueve fuera de
+// ella cae en las celdas del borde: sigue siendo correcto, solo con más
+// candidatos. Un nivel que no entra en MaxCeldas celdas de TamCelda px
+// usa celdas más grandes en vez de más celdas.
+// ============================================================================
+const float TamCelda = 128.0f;
+const int MaxCeldas = 32768;        // Columnas * Filas (128 KB por arreglo de la grilla)
+
+// Máximo de índices que devuelve una consulta
+const int MaxContactos = 512;
+
+struct MundoColision
+{
+    Rectangle* Rects;
+    unsigned char* Etiquetas;
+    unsigned char* Datos;
+    int Num;
+    int NumEstaticos;
+
+    // Grilla: esquina del nivel, tamaño de celda y celdas por lado
+    Vector2 Origen;
+    float LadoCelda;
+    float InvLadoCelda;
+    int Columnas, Filas;
+
+    // Estáticos: primera celda del rango que ocupan (X | Y << 16; el rango
+    // entero sale de Rects al armar la grilla).
+    // Dinámicos: la celda de su esquina superior izquierda en su grilla.
+    unsigned int* Celdas;
+
+    // Grilla de estáticos
+    int* InicioEstatico;        // Columnas * Filas + 1 desplazamientos
+    int* IndicesEstaticos;
+
+    // Cuánto se movió cada dinámico en su último tick (índice - NumEstaticos).
+    // La física lo usa para llevar al jugador parado sobre algo que se mueve.
+    Vector2* Desplazamientos;
+
+    // Grilla de dinámicos (cada uno en una sola celda). Mismas celdas que la
+    // principal, pero solo donde aparecen los dinámicos y una más de cada
+    // lado; los que se alejan caen en su borde. Se rearma mientras el juego
+    // corre, así que cuesta según esa zona y no según el tamaño del nivel.
+    Vector2 OrigenDinamico;
+    int ColumnasDinamicas, FilasDinamicas;
+    int* InicioDinamico;        // ColumnasDinamicas * FilasDinamicas + 1 desplazamientos
+    int* IndicesDinamicos;
+    int MargenDinamico;         // Celdas hacia arriba/izquierda que puede ocupar un dinámico
+
+    int* Cursor;                // Auxiliar del armado (una entrada por celda)
+};
+
+// Reserva los arreglos paralelos para 'numEstaticos' + 'numDinamicos'
+// colisionadores. Después se completan Rects/Etiquetas/Datos y se llama a
+// IndexarMundo(). Devuelve false si la arena no alcanza.
+bool ReservarMundo(MundoColision& mundo, ArenaNivel& arena, int numEstaticos, int numDinamicos);
+
+// Dimensiona la grilla con los límites de todo lo cargado, arma la de
+// estáticos y reserva la de dinámicos (el tamaño de los dinámicos debe
+// estar ya cargado: no cambia durante el nivel).
+bool IndexarMundo(MundoColision& mundo, ArenaNivel& arena);
+
+// Vuelve a ubicar los dinámicos en la grilla (después de moverlos).
+// Si ninguno cambió de celda la grilla queda como estaba.
+void ActualizarDinamicos(MundoColision& mundo);
+
+// Índices de los colisionadores con etiqueta en 'mascara' que se superponen
+// con 'rect', en orden creciente (el orden en que se cargaron). Escribe
+// hasta 'maximo' y devuelve cuántos escribió.
+int ConsultarMundo(const MundoColision& mundo, Rectangle rect, unsigned char mascara,
+                   int* salida, int maximo);
@@ -0,0 +1,384 @@
+﻿#include "Nivel.hpp"
+#include "Puerta.hpp"
+#include "FisicaJugador.hpp"
+#include "Reglas.hpp"
+#include "raylib.h"
+#include <algorithm>
+
+// ============================================================================
+// DISEÑO DEL NIVEL 1 (posiciones precisas del diseño original)
+// ============================================================================
+static const Vector2 PlataformasNivel1[] = {
+    { 155, 550 },
+    { 455, 500 },
+    { 755, 450 },
+    { 585, 250 },
+    { 285, 300 }
+};
+
+static const Vector2 CajasNivel1[] = {
+    { 865, 350 }
+};
+
+// Terreno: una fila de 18 tiles (el ancho de la pantalla y dos más);
+// los primeros cinco son suelo y el resto pinchos
+static const unsigned char TilesNivel1[] = {
+    TILE_SUELO, TILE_SUELO, TILE_SUELO, TILE_SUELO, TILE_SUELO,
+    TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS,
+    TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS, TILE_PINCHOS
+};
+
+// Murciélagos: posición inicial y límites en X para que se muevan de lado a lado.
+// El último sube y baja sobre los pinchos, a la derecha de la caja.
+static const SpawnEnemigo EnemigosNivel1[] = {
+    { 585, 200, 545, 735 },
+    { 455, 450, 415, 605 },
+    { 960, 420, 960, 960, COMP_VERTICAL, 380, 560 }
+};
+
+// ============================================================================
+// COLISIONADORES FIJOS DE TODO NIVEL
+// ============================================================================
+// Van al principio del Mundo, antes que las plataformas: el terreno tiene
+// que resolverse primero (igual que antes de tener un mundo de colisión).
+// Después de los tramos del terreno va la puerta.
+static int ColisionadoresFijos(const Nivel& nivel)
+{
+    return nivel.NumTramosTerreno + 1;
+}
+
+static void CargarColisionador(MundoColision& mundo, int i, Rectangle rect,
+                               EtiquetaColision etiqueta, unsigned char dato)
+{
+    mundo.Rects[i] = rect;
+    mundo.Etiquetas[i] = etiqueta;
+    mundo.Datos[i] = dato;
+}
+
+static void ReconstruirEntidades(Nivel& nivel);
+
+// ============================================================================
+// MURCIÉLAGOS AGRUPADOS POR COMPORTAMIENTO
+// ============================================================================
+// La tabla de aparición se ordena (sin mezclar el orden dentro de cada
+// comportamiento) para que ActualizarEnemigos mueva cada grupo con un solo
+// bucle. Las patrullas del nivel 1 quedan en el orden del diseño.
+// Un murciélago al que le faltan los datos de su comportamiento (ver
+// SpawnEnemigo) quedaría quieto o clavado en y = 0: patrulla y se avisa.
+static bool ComportamientoCompleto(const SpawnEnemigo& s)
+{
+    switch (s.Comportamiento)
+    {
+    case COMP_VERTICAL: return s.MinY < s.MaxY;
+    case COMP_ONDA:     return s.Amplitud > 0 && s.Frecuencia > 0;
+    case COMP_PICADA:   return s.Radio > 0;
+    case COMP_RUTA:     return s.NumPuntos > 0;
+    default:            return true;
+    }
+}
+
+static void AgruparEnemigos(Nivel& nivel)
+{
+    SpawnEnemigo* spawn = nivel.SpawnEnemigos;
+    const int cantidad = nivel.NumEnemigos;
+
+    for (int i = 0; i < cantidad; i++)
+    {
+        SpawnEnemigo& s = spawn[i];
+        if (s.Comportamiento >= COMP_CANTIDAD) s.Comportamiento = COMP_PATRULLA;
+        if (s.PrimerPunto < 0 || s.NumPuntos < 0 || s.PrimerPunto + s.NumPuntos > nivel.NumPuntosRuta)
+            s.PrimerPunto = s.NumPuntos = 0;
+        if (!ComportamientoCompleto(s))
+        {
+            TraceLog(LOG_WARNING, "NIVEL: al murciélago %i le faltan los datos del comportamiento %i, patrulla",
+                     i, (int)s.Comportamiento);
+            s.Comportamiento = COMP_PATRULLA;
+        }
+    }
+
+    std::stable_sort(spawn, spawn + cantidad, [](const SpawnEnemigo& a, const SpawnEnemigo& b) {
+        return a.Comportamiento < b.Comportamiento;
+    });
+
+    int c = 0;
+    for (int i = 0; i < cantidad; i++)
+        while (c <= spawn[i].Comportamiento) nivel.InicioComportamiento[c++] = i;
+    while (c <= COMP_CANTIDAD) nivel.InicioComportamiento[c++] = cantidad;
+}
+
+// Carga en el murciélago los parámetros de su comportamiento
+static void ConfigurarEnemigo(Enemigo& e, const SpawnEnemigo& s, const Vector2* puntosRuta)
+{
+    e.Comportamiento = s.Comportamiento;
+    e.MinY = s.MinY;
+    e.MaxY = s.MaxY;
+    e.Amplitud = s.Amplitud;
+    e.Frecuencia = s.Frecuencia;
+    e.Radio = s.Radio;
+    e.Puntos = s.NumPuntos > 0 ? puntosRuta + s.PrimerPunto : nullptr;
+    e.NumPuntos = s.NumPuntos;
+}
+
+// Copia una tabla de diseño a la arena
+template <typename T>
+static T* CopiarTabla(ArenaNivel& arena, const T* origen, int cantidad)
+{
+    T* destino = arena.ReservarArreglo<T>(cantidad);
+    if (destino)
+        for (int i = 0; i < cantidad; i++) destino[i] = origen[i];
+    return destino;
+}
+
+// ============================================================================
+// CARGA DEL NIVEL EN LA ARENA
+// ============================================================================
+bool CargarNivel(int id, ArenaNivel& arena, Nivel& nivel)
+{
+    if (id != 1)
+    {
+        TraceLog(LOG_WARNING, "NIVEL: el nivel %i no existe", id);
+        return false;
+    }
+
+    DisenoNivel diseno = {};
+    diseno.Nombre = "Nivel 1 - El bosque";
+    diseno.Plataformas = PlataformasNivel1;
+    diseno.NumPlataformas = sizeof(PlataformasNivel1) / sizeof(PlataformasNivel1[0]);
+    diseno.Cajas = CajasNivel1;
+    diseno.NumCajas = sizeof(CajasNivel1) / sizeof(CajasNivel1[0]);
+    diseno.Enemigos = EnemigosNivel1;
+    diseno.NumEnemigos = sizeof(EnemigosNivel1) / sizeof(EnemigosNivel1[0]);
+    diseno.Tiles = TilesNivel1;
+    diseno.ColumnasTiles = sizeof(TilesNivel1) / sizeof(TilesNivel1[0]);
+    diseno.FilasTiles = 1;
+
+    return ConstruirNivel(id, diseno, arena, nivel);
+}
+
+// ============================================================================
+// CONSTRUCCIÓN DEL NIVEL A PARTIR DE UN DISEÑO
+// ============================================================================
+bool ConstruirNivel(int id, const DisenoNivel& diseno, ArenaNivel& arena, Nivel& nivel)
+{
+    nivel = {};
+    nivel.Id = id;
+    nivel.Nombre = arena.CopiarTexto(diseno.Nombre);
+
+    nivel.NumPlataformas = diseno.NumPlataformas;
+    nivel.NumPlataformasUnaVia = diseno.NumPlataformasUnaVia;
+    nivel.NumPlataformasMoviles = diseno.NumPlataformasMoviles;
+    nivel.NumCajas = diseno.NumCajas;
+    nivel.NumEnemigos = diseno.NumEnemigos;
+    nivel.NumPuntosRuta = diseno.NumPuntosRuta;
+
+    // --- Tablas de aparición ---
+    nivel.SpawnPlataformas = CopiarTabla(arena, diseno.Plataformas, nivel.NumPlataformas);
+    nivel.SpawnUnaVia = CopiarTabla(arena, diseno.PlataformasUnaVia, nivel.NumPlataformasUnaVia);
+    nivel.SpawnMoviles = CopiarTabla(arena, diseno.PlataformasMoviles, nivel.NumPlataformasMoviles);
+    nivel.SpawnCajas = CopiarTabla(arena, diseno.Cajas, nivel.NumCajas);
+    nivel.SpawnEnemigos = CopiarTabla(arena, diseno.Enemigos, nivel.NumEnemigos);
+    nivel.PuntosRuta = CopiarTabla(arena, diseno.PuntosRuta, nivel.NumPuntosRuta);
+    if (nivel.SpawnEnemigos) AgruparEnemigos(nivel);
+
+    // --- Entidades (arreglos contiguos dentro de la arena) ---
+    nivel.Plataformas = static_cast<Plataforma*>(
+        arena.Reservar(sizeof(Plataforma) * nivel.NumPlataformas, alignof(Plataforma)));
+    nivel.PlataformasUnaVia = static_cast<Plataforma*>(
+        arena.Reservar(sizeof(Plataforma) * nivel.NumPlataformasUnaVia, alignof(Plataforma)));
+    nivel.PlataformasMoviles = static_cast<PlataformaMovil*>(
+        arena.Reservar(sizeof(PlataformaMovil) * nivel.NumPlataformasMoviles, alignof(PlataformaMovil)));
+    nivel.Cajas = static_cast<Caja*>(
+        arena.Reservar(sizeof(Caja) * nivel.NumCajas, alignof(Caja)));
+    nivel.Enemigos = static_cast<Enemigo*>(
+        arena.Reservar(sizeof(Enemigo) * nivel.NumEnemigos, alignof(Enemigo)));
+
+    // --- Terreno (la grilla también define sus colisionadores) ---
+    bool terrenoOk = IniciarCapa(nivel.Terreno, arena, diseno.Tiles,
+                                 diseno.ColumnasTiles, diseno.FilasTiles, { 0, 640 });
+    nivel.NumTramosTerreno = terrenoOk ? ContarTramosColision(nivel.Terreno) : 0;
+
+    // --- Mundo de colisión (un tramo por tipo, uno detrás del otro) ---
+    int numEstaticos = ColisionadoresFijos(nivel) + nivel.NumPlataformas + nivel.NumPlataformasUnaVia + nivel.NumCajas;
+    int numDinamicos = nivel.NumEnemigos + nivel.NumPlataformasMoviles;
+    bool mundoOk = ReservarMundo(nivel.Mundo, arena, numEstaticos, numDinamicos);
+    if (mundoOk)
+    {
+        nivel.RectPlataformas = nivel.Mundo.Rects + ColisionadoresFijos(nivel);
+        nivel.RectUnaVia = nivel.RectPlataformas + nivel.NumPlataformas;
+        nivel.RectCajas = nivel.RectUnaVia + nivel.NumPlataformasUnaVia;
+        nivel.RectEnemigos = nivel.RectCajas + nivel.NumCajas;
+        nivel.RectMoviles = nivel.RectEnemigos + nivel.NumEnemigos;
+    }
+
+    // Un arreglo vacío es válido; solo falla si se pidió algo y no hubo lugar
+    bool faltaLugar = !nivel.Nombre ||
+        (nivel.NumPlataformas > 0 && (!nivel.SpawnPlataformas || !nivel.Plataformas)) ||
+        (nivel.NumPlataformasUnaVia > 0 && (!nivel.SpawnUnaVia || !nivel.PlataformasUnaVia)) ||
+        (nivel.NumPlataformasMoviles > 0 && (!nivel.SpawnMoviles || !nivel.PlataformasMoviles)) ||
+        (nivel.NumCajas > 0 && (!nivel.SpawnCajas || !nivel.Cajas)) ||
+        (nivel.NumEnemigos > 0 && (!nivel.SpawnEnemigos || !nivel.Enemigos)) ||
+        (nivel.NumPuntosRuta > 0 && !nivel.PuntosRuta) ||
+        !terrenoOk || !mundoOk;
+
+    if (!faltaLugar)
+    {
+        // --- Zonas fijas ---
+        // Tramos del terreno (suelo: una vía; pinchos: peligro) y la puerta,
+        // que calcula su propia hitbox (depende del alto de su sprite)
+        Puerta puerta;
+        CargarTramosColision(nivel.Terreno, nivel.Mundo, 0);
+        CargarColisionador(nivel.Mundo, nivel.NumTramosTerreno, puerta.GetRect(), COL_DISPARADOR, DISPARADOR_PUERTA);
+
+        ReconstruirEntidades(nivel);
+        faltaLugar = !IndexarMundo(nivel.Mundo, arena);
+    }
+
+    if (faltaLugar)
+    {
+        TraceLog(LOG_ERROR, "NIVEL: la arena no alcanza para el nivel %i", id);
+        arena.Reiniciar();
+        nivel = {};
+        return false;
+    }
+
+    nivel.BytesUsados = arena.BytesUsados();
+    return true;
+}
+
+// ============================================================================
+// REINICIO DE ENTIDADES DESDE LAS TABLAS DE APARICIÓN
+// ============================================================================
+// Las entidades son datos planos: se reconstruyen en su mismo lugar de la
+// arena, sin reservar memoria ni tocar disco. Es el único lugar donde se
+// leen las dimensiones de las texturas para armar los AABB.
+static void ReconstruirEntidades(Nivel& nivel)
+{
+    MundoColision& mundo = nivel.Mundo;
+    int base = ColisionadoresFijos(nivel);
+
+    for (int i = 0; i < nivel.NumPlataformas; i++)
+    {
+        new (&nivel.Plataformas[i]) Plataforma(nivel.SpawnPlataformas[i].x, nivel.SpawnPlataformas[i].y);
+        CargarColisionador(mundo, base + i, nivel.Plataformas[i].GetRect(), COL_SOLIDO, SUELO_PASTO);
+    }
+    base += nivel.NumPlataformas;
+
+    // Mismo sprite, más claras: se atraviesan desde abajo
+    for (int i = 0; i < nivel.NumPlataformasUnaVia; i++)
+    {
+        new (&nivel.PlataformasUnaVia[i]) Plataforma(nivel.SpawnUnaVia[i].x, nivel.SpawnUnaVia[i].y);
+        nivel.PlataformasUnaVia[i].Tinte = Fade(WHITE, 0.7f);
+        CargarColisionador(mundo, base + i, nivel.PlataformasUnaVia[i].GetRect(), COL_UNA_VIA, SUELO_PASTO);
+    }
+    base += nivel.NumPlataformasUnaVia;
+
+    for (int i = 0; i < nivel.NumCajas; i++)
+    {
+        new (&nivel.Cajas[i]) Caja(nivel.SpawnCajas[i].x, nivel.SpawnCajas[i].y);
+        CargarColisionador(mundo, base + i, nivel.Cajas[i].GetRect(), COL_SOLIDO, SUELO_CAJA);
+    }
+    base += nivel.NumCajas;
+
+    for (int i = 0; i < nivel.NumEnemigos; i++)
+    {
+        const SpawnEnemigo& s = nivel.SpawnEnemigos[i];
+        new (&nivel.Enemigos[i]) Enemigo(s.X, s.Y, s.MinX, s.MaxX);
+        ConfigurarEnemigo(nivel.Enemigos[i], s, nivel.PuntosRuta);
+        CargarColisionador(mundo, base + i, nivel.Enemigos[i].GetRect(), COL_ENEMIGO, PERDIDA_MURCIELAGO);
+    }
+    base += nivel.NumEnemigos;
+
+    for (int i = 0; i < nivel.NumPlataformasMoviles; i++)
+    {
+        const SpawnPlataformaMovil& s = nivel.SpawnMoviles[i];
+        new (&nivel.PlataformasMoviles[i]) PlataformaMovil(s.X, s.Y, s.FinX, s.FinY, s.Velocidad);
+        CargarColisionador(mundo, base + i, nivel.PlataformasMoviles[i].GetRect(), COL_UNA_VIA, SUELO_PASTO);
+        mundo.Desplazamientos[base + i - mundo.NumEstaticos] = { 0, 0 };
+    }
+}
+
+void ReiniciarNivel(Nivel& nivel)
+{
+    ReconstruirEntidades(nivel);
+    ActualizarDinamicos(nivel.Mundo);   // Los murciélagos vuelven a su lugar de aparición
+}
+
+// ============================================================================
+// ACTUALIZACIÓN DE ENEMIGOS
+// ============================================================================
+// Cada comportamiento mueve su tramo de murciélagos con su propio bucle;
+// después el aleteo de todos y la copia de posiciones a los AABB.
+// El tamaño del murciélago no cambia: solo se mueve el origen del AABB.
+// La copia va en otra pasada: hacerla justo después de mover la relee
+// mientras su escritura sigue en vuelo (el compilador junta x e y en una
+// sola lectura) y eso triplicaba el costo por murciélago.
+void ActualizarEnemigos(Nivel& nivel, float dt, Vector2 jugador)
+{
+    Enemigo* enemigos = nivel.Enemigos;
+    Rectangle* rects = nivel.RectEnemigos;
+    const int cantidad = nivel.NumEnemigos;
+    const int* inicio = nivel.InicioComportamiento;
+
+    PatrullarEnemigos(enemigos + inicio[COMP_PATRULLA], inicio[COMP_PATRULLA + 1] - inicio[COMP_PATRULLA], dt);
+    VolarVertical(enemigos + inicio[COMP_VERTICAL], inicio[COMP_VERTICAL + 1] - inicio[COMP_VERTICAL], dt);
+    VolarEnOnda(enemigos + inicio[COMP_ONDA], inicio[COMP_ONDA + 1] - inicio[COMP_ONDA], dt);
+    VolarEnPicada(enemigos + inicio[COMP_PICADA], inicio[COMP_PICADA + 1] - inicio[COMP_PICADA], dt, jugador);
+    SeguirRutas(enemigos + inicio[COMP_RUTA], inicio[COMP_RUTA + 1] - inicio[COMP_RUTA], dt);
+    AletearEnemigos(enemigos, cantidad, dt);
+
+    for (int i = 0; i < cantidad; i++)
+    {
+        rects[i].x = enemigos[i].Posicion.x;
+        rects[i].y = enemigos[i].Posicion.y;
+    }
+
+    ActualizarDinamicos(nivel.Mundo);
+}
+
+// ============================================================================
+// ACTUALIZACIÓN DE PLATAFORMAS MÓVILES
+// ============================================================================
+// Igual que los murciélagos: primero se mueven todas y después se copian
+// posición y desplazamiento a los arreglos del Mundo.
+void ActualizarPlataformasMoviles(Nivel& nivel, float dt)
+{
+    PlataformaMovil* moviles = nivel.PlataformasMoviles;
+    Rectangle* rects = nivel.RectMoviles;
+    Vector2* desplazamientos = nivel.Mundo.Desplazamientos + nivel.NumEnemigos;
+    const int cantidad = nivel.NumPlataformasMoviles;
+
+    if (cantidad == 0) return;
+
+    for (int i = 0; i < cantidad; i++)
+        moviles[i].Update(dt);
+
+    for (int i = 0; i < cantidad; i++)
+    {
+        rects[i].x = moviles[i].Base.Posicion.x;
+        rects[i].y = moviles[i].Base.Posicion.y;
+        desplazamientos[i] = moviles[i].Desplazamiento;
+    }
+
+    ActualizarDinamicos(nivel.Mundo);
+}
+
+// ============================================================================
+// DESCARGA DEL NIVEL
+// ============================================================================
+void DescargarNivel(Nivel& nivel, ArenaNivel& arena)
+{
+    // Las entidades no son dueñas de recursos; el terreno sí (mallas en GPU)
+    LiberarCapa(nivel.Terreno);
+    arena.Reiniciar();
+    nivel = {};
+}
+
+// ============================================================================
+// REPORTE DE MEMORIA POR NIVEL
+// ============================================================================
+void ReportarMemoriaNivel(const Nivel& nivel, const ArenaNivel& arena)
+{
+    TraceLog(LOG_INFO, "NIVEL %i '%s': %zu bytes de arena (pico %zu / capacidad %zu)",
+        nivel.Id, nivel.Nombre ? nivel.Nombre : "?",
+        nivel.BytesUsados, arena.BytesPico(), arena.Capacidad());
+}
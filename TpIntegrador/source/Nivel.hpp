@@ -0,0 +1,159 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Arena.hpp"
+#include "Plataforma.hpp"
+#include "Caja.hpp"
+#include "Enemigo.hpp"
+#include "PlataformaMovil.hpp"
+#include "MundoColision.hpp"
+#include "CapaTiles.hpp"
+
+// ============================================================================
+// TABLA DE APARICIÓN DE ENEMIGOS
+// ============================================================================
+// Posición inicial y rango horizontal de cada murciélago. Los campos que
+// siguen son del comportamiento; sin indicarlos (en cero) es la patrulla
+// horizontal de siempre, así que { x, y, minX, maxX } sigue valiendo.
+// Cada comportamiento necesita los suyos: vertical MinY < MaxY, onda
+// Amplitud y Frecuencia > 0, picada Radio > 0 y ruta al menos un punto.
+// Si faltan, el murciélago patrulla (con un aviso en el log).
+// ============================================================================
+struct SpawnEnemigo
+{
+    float X, Y;             // Posición inicial
+    float MinX, MaxX;       // Límites del recorrido horizontal
+    ComportamientoEnemigo Comportamiento = COMP_PATRULLA;
+    float MinY = 0, MaxY = 0;   // Vertical
+    float Amplitud = 0;         // Onda: píxeles
+    float Frecuencia = 0;       // Onda: vueltas por segundo
+    float Radio = 0;            // Picada
+    int PrimerPunto = 0;        // Ruta: tramo de DisenoNivel::PuntosRuta
+    int NumPuntos = 0;
+};
+
+// ============================================================================
+// TABLA DE APARICIÓN DE PLATAFORMAS MÓVILES
+// ============================================================================
+// Punto de partida, punto de llegada y velocidad del ida y vuelta.
+// ============================================================================
+struct SpawnPlataformaMovil
+{
+    float X, Y;             // Posición inicial
+    float FinX, FinY;       // Otro extremo del recorrido
+    float Velocidad;        // Píxeles por segundo
+};
+
+// ============================================================================
+// DISEÑO DE UN NIVEL
+// ============================================================================
+// Descripción de solo lectura (tablas de aparición). CargarNivel() usa las
+// tablas fijas del juego; herramientas como el benchmark pueden armar las
+// suyas y construir el nivel con ConstruirNivel().
+// ============================================================================
+struct DisenoNivel
+{
+    const char* Nombre;
+    const Vector2* Plataformas;
+    int NumPlataformas;
+    const Vector2* PlataformasUnaVia;           // Se atraviesan desde abajo
+    int NumPlataformasUnaVia;
+    const SpawnPlataformaMovil* PlataformasMoviles;
+    int NumPlataformasMoviles;
+    const Vector2* Cajas;
+    int NumCajas;
+    const SpawnEnemigo* Enemigos;
+    int NumEnemigos;
+    const Vector2* PuntosRuta;                  // Puntos de todas las rutas, una detrás de la otra
+    int NumPuntosRuta;
+    const unsigned char* Tiles;                 // IdTile fila por fila (la fila 0 empieza en y = 640)
+    int ColumnasTiles;
+    int FilasTiles;
+};
+
+// Identificadores de los disparadores (Dato de los COL_DISPARADOR)
+enum Disparador : unsigned char { DISPARADOR_PUERTA };
+
+// ============================================================================
+// DATOS DE UN NIVEL
+// ============================================================================
+// Todo lo que cuelga de este struct vive en la ArenaNivel: tablas de
+// aparición, entidades, mundo de colisión y textos. No tiene destructor;
+// se descarta completo con DescargarNivel() + ArenaNivel::Reiniciar().
+// ============================================================================
+struct Nivel
+{
+    int Id;
+    const char* Nombre;
+
+    // --- Tablas de aparición (datos de diseño copiados a la arena) ---
+    Vector2* SpawnPlataformas;
+    Vector2* SpawnUnaVia;
+    SpawnPlataformaMovil* SpawnMoviles;
+    Vector2* SpawnCajas;
+    SpawnEnemigo* SpawnEnemigos;        // Ordenada por comportamiento
+    Vector2* PuntosRuta;
+
+    // --- Entidades construidas a partir de las tablas ---
+    Plataforma* Plataformas;
+    Plataforma* PlataformasUnaVia;
+    PlataformaMovil* PlataformasMoviles;
+    Caja* Cajas;
+    Enemigo* Enemigos;
+
+    int NumPlataformas;
+    int NumPlataformasUnaVia;
+    int NumPlataformasMoviles;
+    int NumCajas;
+    int NumEnemigos;
+    int NumPuntosRuta;
+
+    // Murciélagos agrupados por comportamiento: los del comportamiento c
+    // son [InicioComportamiento[c], InicioComportamiento[c + 1])
+    int InicioComportamiento[COMP_CANTIDAD + 1];
+
+    // --- Mundo de colisión ---
+    // Todo lo que se toca, con su etiqueta, en el orden:
+    //   [terreno | puerta | plataformas | una vía | cajas]  estáticos
+    //   [murciélagos | plataformas móviles]               dinámicos
+    // El terreno son los tramos de tiles iguales de la capa (uno por tramo).
+    // Los Rect* apuntan al tramo de cada tipo dentro de Mundo.Rects.
+    MundoColision Mundo;
+    Rectangle* RectPlataformas;     // Estáticos: se calculan al construir/reiniciar
+    Rectangle* RectUnaVia;
+    Rectangle* RectCajas;
+    Rectangle* RectEnemigos;        // Dinámicos: ActualizarEnemigos() los rehace una vez por tick
+    Rectangle* RectMoviles;         // Dinámicos: ActualizarPlataformasMoviles() ídem
+
+    // --- Terreno (suelo y pinchos como grilla de tiles) ---
+    CapaTiles Terreno;
+    int NumTramosTerreno;       // Colisionadores del terreno al principio del Mundo
+
+    // Memoria de arena ocupada por el nivel (para el reporte)
+    size_t BytesUsados;
+};
+
+// Construye el nivel 'id' dentro de la arena. Devuelve false si no existe
+// o si la arena no alcanza.
+bool CargarNivel(int id, ArenaNivel& arena, Nivel& nivel);
+
+// Construye un nivel a partir de un diseño cualquiera (copia las tablas a la arena)
+bool ConstruirNivel(int id, const DisenoNivel& diseno, ArenaNivel& arena, Nivel& nivel);
+
+// Vuelve a construir las entidades desde las tablas de aparición
+// (sin reservas ni E/S; se usa al reintentar). También recalcula los AABB.
+void ReiniciarNivel(Nivel& nivel);
+
+// Mueve los murciélagos (un tramo por comportamiento), actualiza sus AABB
+// en RectEnemigos y los vuelve a ubicar en la grilla del Mundo.
+// 'jugador' es el centro del jugador (lo miran los que pican).
+void ActualizarEnemigos(Nivel& nivel, float dt, Vector2 jugador);
+
+// Lo mismo para las plataformas móviles; además publica cuánto se movió
+// cada una en Mundo.Desplazamientos. Va antes de la física del jugador.
+void ActualizarPlataformasMoviles(Nivel& nivel, float dt);
+
+// Descarta el nivel (y las mallas del terreno) y vacía la arena de una sola vez
+void DescargarNivel(Nivel& nivel, ArenaNivel& arena);
+
+// Informa por consola la memoria que ocupa el nivel en la arena
+void ReportarMemoriaNivel(const Nivel& nivel, const ArenaNivel& arena);
@@ -0,0 +1,46 @@
+﻿#include "Parallax.hpp"
+#include "raylib.h"
+
+// ============================================================================
+// ARMADO
+// ============================================================================
+void IniciarParallax(FondoParallax& fondo)
+{
+    fondo.NumCapas = 0;
+}
+
+bool AgregarCapaParallax(FondoParallax& fondo, Texture2D textura, float factor,
+                         float y, float escala, Color tinte)
+{
+    if (fondo.NumCapas == MaxCapasParallax) return false;
+
+    // UV fuera de [0, 1] repiten la textura: el quad puede ser más ancho
+    SetTextureWrap(textura, TEXTURE_WRAP_REPEAT);
+
+    fondo.Capas[fondo.NumCapas++] = { textura, factor, y, escala, tinte };
+    return true;
+}
+
+// ============================================================================
+// DIBUJO
+// ============================================================================
+// La fuente es la vista pasada a píxeles de la textura y corrida según el
+// factor: con Factor 0 y la vista en el origen es la textura entera, como
+// un DrawTexture.
+void DibujarParallax(const FondoParallax& fondo, Rectangle vista)
+{
+    for (int i = 0; i < fondo.NumCapas; i++)
+    {
+        const CapaParallax& c = fondo.Capas[i];
+
+        Rectangle fuente = {
+            vista.x * c.Factor / c.Escala,
+            0,
+            vista.width / c.Escala,
+            (float)c.Textura.height
+        };
+        Rectangle destino = { vista.x, c.Y, vista.width, c.Textura.height * c.Escala };
+
+        DrawTexturePro(c.Textura, fuente, destino, { 0, 0 }, 0, c.Tinte);
+    }
+}
@@ -0,0 +1,44 @@
+﻿#pragma once
+#include "raylib.h"
+
+// ============================================================================
+// FONDO EN CAPAS (PARALLAX)
+// ============================================================================
+// Capas de fondo que se desplazan más lento que el mundo: Factor 0 queda
+// fija en la pantalla, 1 se mueve con el mundo. Cada capa es una textura
+// con wrap en repetición dibujada con un solo quad del tamaño de la vista;
+// el desplazamiento es un corrimiento de las UV. Una capa cuesta lo mismo
+// sin importar el ancho del mundo, y agregar una capa es agregar un quad.
+//
+// La vista es el rectángulo del mundo que se ve (el mismo que recibe
+// DibujarCapa); sin cámara es la pantalla. El quad se ubica en la vista,
+// así que también sirve dentro de BeginMode2D.
+//
+// Las texturas no son de la capa: las carga y descarga quien las pasa.
+// ============================================================================
+const int MaxCapasParallax = 8;
+
+struct CapaParallax
+{
+    Texture2D Textura;
+    float Factor;           // Cuánto del desplazamiento de la vista sigue
+    float Y;                // Borde superior de la capa, en el mundo
+    float Escala;           // Tamaño de la textura en pantalla
+    Color Tinte;
+};
+
+struct FondoParallax
+{
+    CapaParallax Capas[MaxCapasParallax];   // De la más lejana a la más cercana
+    int NumCapas;
+};
+
+void IniciarParallax(FondoParallax& fondo);
+
+// Agrega una capa delante de las que ya hay (pone su textura en
+// repetición). Devuelve false si no entran más capas.
+bool AgregarCapaParallax(FondoParallax& fondo, Texture2D textura, float factor,
+                         float y, float escala, Color tinte = WHITE);
+
+// Dibuja todas las capas para la vista dada: un quad por capa
+void DibujarParallax(const FondoParallax& fondo, Rectangle vista);
@@ -0,0 +1,178 @@
+﻿#include "Particulas.hpp"
+#include "Instanciado.hpp"
+#include "raylib.h"
+#include "rlgl.h"           // Textura blanca por defecto (sin cargar nada)
+#include <cmath>
+
+// SSE en x64 y en x86 con /arch:SSE2 (el mínimo que ya pide la simulación)
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define PARTICULAS_SSE 1
+#endif
+
+using namespace Particulas;
+
+// ============================================================================
+// POOL (un arreglo por campo; las vivas son [0, NumVivas))
+// ============================================================================
+// Capacidad es múltiplo de 4: la integración procesa de a cuatro hasta
+// pasar NumVivas y los carriles sobrantes caen en lugares libres del pool.
+static_assert(Capacidad % 4 == 0, "La capacidad tiene que ser multiplo de 4");
+
+alignas(16) static float X[Capacidad];
+alignas(16) static float Y[Capacidad];
+alignas(16) static float VX[Capacidad];
+alignas(16) static float VY[Capacidad];
+alignas(16) static float Vida[Capacidad];          // Segundos que le quedan
+alignas(16) static float InvVidaTotal[Capacidad];  // Para desvanecerla al final
+alignas(16) static float Gravedad[Capacidad];
+alignas(16) static float Arrastre[Capacidad];
+static float Tamanio[Capacidad];
+static Color Tinte[Capacidad];
+
+static int NumVivas = 0;
+
+// Azar propio (solo visual: no toca el de nadie más)
+static unsigned int Semilla = 0x2545F491u;
+
+static float Azar01()
+{
+    Semilla = Semilla * 1664525u + 1013904223u;
+    return (float)(Semilla >> 8) * (1.0f / 16777216.0f);
+}
+
+static float Entre(float minimo, float maximo)
+{
+    return minimo + (maximo - minimo) * Azar01();
+}
+
+static unsigned char Mezclar(unsigned char a, unsigned char b, float t)
+{
+    return (unsigned char)(a + (b - a) * t);
+}
+
+// ============================================================================
+// EMITIR
+// ============================================================================
+void Particulas::Emitir(const EstiloRafaga& estilo, Vector2 posicion, int cantidad)
+{
+    for (int k = 0; k < cantidad && NumVivas < Capacidad; k++)
+    {
+        int i = NumVivas++;
+
+        float angulo = Entre(estilo.AnguloMin, estilo.AnguloMax);
+        float velocidad = Entre(estilo.VelocidadMin, estilo.VelocidadMax);
+        float vida = Entre(estilo.VidaMin, estilo.VidaMax);
+        float t = Azar01();
+
+        X[i] = posicion.x;
+        Y[i] = posicion.y;
+        VX[i] = std::cos(angulo) * velocidad;
+        VY[i] = std::sin(angulo) * velocidad;
+        Vida[i] = vida;
+        InvVidaTotal[i] = vida > 0 ? 1.0f / vida : 0.0f;
+        Gravedad[i] = estilo.Gravedad;
+        Arrastre[i] = estilo.Arrastre;
+        Tamanio[i] = Entre(estilo.TamanioMin, estilo.TamanioMax);
+        Tinte[i] = {
+            Mezclar(estilo.ColorA.r, estilo.ColorB.r, t),
+            Mezclar(estilo.ColorA.g, estilo.ColorB.g, t),
+            Mezclar(estilo.ColorA.b, estilo.ColorB.b, t),
+            Mezclar(estilo.ColorA.a, estilo.ColorB.a, t)
+        };
+    }
+}
+
+// ============================================================================
+// ACTUALIZAR
+// ============================================================================
+// Primero la integración (arrastre, gravedad, posición, vida) sobre los
+// arreglos contiguos; después una pasada que saca las muertas trayendo la
+// última viva a su lugar.
+void Particulas::Actualizar(float dt)
+{
+#ifdef PARTICULAS_SSE
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 uno = _mm_set1_ps(1.0f);
+
+    for (int i = 0; i < NumVivas; i += 4)
+    {
+        __m128 freno = _mm_sub_ps(uno, _mm_mul_ps(_mm_load_ps(Arrastre + i), vdt));
+        __m128 vx = _mm_mul_ps(_mm_load_ps(VX + i), freno);
+        __m128 vy = _mm_add_ps(_mm_mul_ps(_mm_load_ps(VY + i), freno),
+                               _mm_mul_ps(_mm_load_ps(Gravedad + i), vdt));
+
+        _mm_store_ps(VX + i, vx);
+        _mm_store_ps(VY + i, vy);
+        _mm_store_ps(X + i, _mm_add_ps(_mm_load_ps(X + i), _mm_mul_ps(vx, vdt)));
+        _mm_store_ps(Y + i, _mm_add_ps(_mm_load_ps(Y + i), _mm_mul_ps(vy, vdt)));
+        _mm_store_ps(Vida + i, _mm_sub_ps(_mm_load_ps(Vida + i), vdt));
+    }
+#else
+    for (int i = 0; i < NumVivas; i++)
+    {
+        float freno = 1.0f - Arrastre[i] * dt;
+        VX[i] *= freno;
+        VY[i] = VY[i] * freno + Gravedad[i] * dt;
+        X[i] += VX[i] * dt;
+        Y[i] += VY[i] * dt;
+        Vida[i] -= dt;
+    }
+#endif
+
+    for (int i = 0; i < NumVivas;)
+    {
+        if (Vida[i] > 0) { i++; continue; }
+
+        int u = --NumVivas;
+        X[i] = X[u];
+        Y[i] = Y[u];
+        VX[i] = VX[u];
+        VY[i] = VY[u];
+        Vida[i] = Vida[u];
+        InvVidaTotal[i] = InvVidaTotal[u];
+        Gravedad[i] = Gravedad[u];
+        Arrastre[i] = Arrastre[u];
+        Tamanio[i] = Tamanio[u];
+        Tinte[i] = Tinte[u];
+    }
+}
+
+// ============================================================================
+// DIBUJAR
+// ============================================================================
+// Todas con la textura blanca de raylib (1x1) teñida: para el dibujo
+// instanciado es una sola textura, así que sale en una llamada por cada
+// MaxInstancias partículas.
+void Particulas::Dibujar()
+{
+    if (NumVivas == 0) return;
+
+    const Texture2D blanca = { rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    const Rectangle fuente = { 0, 0, 1, 1 };
+
+    for (int i = 0; i < NumVivas; i++)
+    {
+        float resto = Vida[i] * InvVidaTotal[i];
+        Color c = Tinte[i];
+        c.a = (unsigned char)(c.a * (resto < 1.0f ? resto : 1.0f));
+
+        float lado = Tamanio[i];
+        Instanciado::Agregar(blanca, fuente, { X[i] - lado / 2, Y[i] - lado / 2, lado, lado }, c);
+    }
+
+    Instanciado::Dibujar();
+}
+
+// ============================================================================
+// VARIOS
+// ============================================================================
+void Particulas::Vaciar()
+{
+    NumVivas = 0;
+}
+
+int Particulas::Vivas()
+{
+    return NumVivas;
+}
@@ -0,0 +1,54 @@
+﻿#pragma once
+#include "raylib.h"
+
+// ============================================================================
+// ESTILO DE UNA RÁFAGA
+// ============================================================================
+// Cómo salen las partículas de una ráfaga: cada una toma un valor al azar
+// entre el mínimo y el máximo de cada campo (el color, entre ColorA y ColorB).
+// Los ángulos van en radianes con la Y de la pantalla: -pi/2 es hacia arriba.
+// ============================================================================
+struct EstiloRafaga
+{
+    Color ColorA, ColorB;
+    float VelocidadMin, VelocidadMax;   // Píxeles por segundo
+    float AnguloMin, AnguloMax;
+    float VidaMin, VidaMax;             // Segundos (se desvanecen al final)
+    float TamanioMin, TamanioMax;       // Lado del cuadrado, en píxeles
+    float Gravedad;                     // Píxeles por segundo², positiva hacia abajo
+    float Arrastre;                     // Fracción de velocidad que se pierde por segundo
+};
+
+// ============================================================================
+// SISTEMA DE PARTÍCULAS (POOL SoA DE CAPACIDAD FIJA)
+// ============================================================================
+// Polvo, impactos y efectos de muerte. Cada dato de las partículas vive en
+// su propio arreglo (X, Y, velocidades, vida...) y las vivas están siempre
+// al principio, así la integración recorre memoria contigua de a cuatro
+// con SSE. Una partícula que muere se reemplaza con la última viva.
+//
+// Los arreglos son estáticos: nada se reserva, ni al arrancar ni después.
+// Si el pool está lleno, las ráfagas nuevas salen incompletas.
+//
+// Es solo visual: corre con el dt del frame, no con el tick, y no entra en
+// las instantáneas ni en la simulación.
+// ============================================================================
+namespace Particulas
+{
+    const int Capacidad = 65536;
+
+    // Lanza 'cantidad' partículas desde 'posicion'
+    void Emitir(const EstiloRafaga& estilo, Vector2 posicion, int cantidad);
+
+    // Mueve todas las vivas y descarta las que se terminaron
+    void Actualizar(float dt);
+
+    // Encola todas las vivas en el dibujo instanciado y lo dibuja
+    // (un cuadrado blanco teñido por partícula, una llamada por tanda)
+    void Dibujar();
+
+    // Descarta todas (al reiniciar o cambiar de pantalla)
+    void Vaciar();
+
+    int Vivas();
+}
@@ -2,21 +2,22 @@
 #include "raylib.h"
 
 // ============================================================================
-// CONSTRUCTOR: Carga textura y posiciona la plataforma
+// CONSTRUCTOR: Asigna textura y posiciona la plataforma
 // ============================================================================
 Plataforma::Plataforma(float x, float y)
 {
-	Textura = LoadTexture("PisoFlotante.png");		// Sprite del piso flotante
-	Escala = 0.80f;									// Tamao reducido para esttica del nivel
-	Posicion = { x, y };							// Ubicacin exacta en el mundo
+	Textura = TEX_PLATAFORMA;						// Sprite del piso flotante
+	Escala = 0.80f;									// Tamaño reducido para estética del nivel
+	Posicion = { x, y };							// Ubicación exacta en el mundo
+	Tinte = WHITE;									// Sin teñir
 }
 
 // ============================================================================
-// RECTNGULO DE COLISIN
+// RECTÁNGULO DE COLISIÓN
 // ============================================================================
 Rectangle Plataforma::GetRect() const
 {
-	return { Posicion.x, Posicion.y, Textura.width * Escala, Textura.height * Escala };
+	return { Posicion.x, Posicion.y, Recursos::Ancho(Textura) * Escala, Recursos::Alto(Textura) * Escala };
 }
 
 // ============================================================================
@@ -24,13 +25,5 @@ Rectangle Plataforma::GetRect() const
 // ============================================================================
 void Plataforma::Draw() const
 {
-	DrawTextureEx(Textura, Posicion, 0, Escala, WHITE);
-}
-
-// ============================================================================
-// LIBERACIN DE RECURSOS
-// ============================================================================
-Plataforma::~Plataforma()
-{
-	UnloadTexture(Textura);		// Evita prdidas de memoria
+	DrawTextureEx(Recursos::Textura(Textura), Posicion, 0, Escala, Tinte);
 }
\ No newline at end of file
@@ -1,28 +1,30 @@
 #pragma once
 #include "raylib.h"
+#include "Recursos.hpp"
 
 // ============================================================================
 // CLASE: Plataforma
 // ============================================================================
-// Representa una plataforma esttica del nivel.
-// El jugador y enemigos pueden pararse sobre ella.
+// Representa una plataforma del nivel.
+// El jugador puede pararse sobre ella. Según cómo la cargue el Nivel es
+// sólida, de una vía (se atraviesa desde abajo) o la base de una
+// PlataformaMovil.
+// Es un dato plano: la textura la guarda el gestor de Recursos.
 // ============================================================================
 class  Plataforma
 {
 public:
-	Vector2 Posicion;		// Posicin en pantalla
-	Texture2D Textura;		// Imagen de la plataforma
-	float Escala;			// Factor de tamao para el dibujo
+	Vector2 Posicion;		// Posición en pantalla
+	IdTextura Textura;		// Imagen de la plataforma (identificador en Recursos)
+	float Escala;			// Factor de tamaño para el dibujo
+	Color Tinte;			// Color del dibujo (las de una vía se ven más claras)
 
-	// Constructor: crea una plataforma en (x, y) y carga su textura
+	// Constructor: crea una plataforma en (x, y) (sin cargar nada)
 	Plataforma(float x, float y);
 
 	// Dibuja la plataforma en pantalla
 	void Draw() const;
 
-	// Devuelve su rectngulo de colisin (para fsicas)
+	// Calcula su rectángulo de colisión (el Nivel lo guarda en RectPlataformas)
 	Rectangle GetRect() const;
-
-	// Libera la textura
-	~Plataforma();
 };
\ No newline at end of file
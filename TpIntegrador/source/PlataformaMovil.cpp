@@ -0,0 +1,61 @@
+﻿#include "PlataformaMovil.hpp"
+#include "raylib.h"
+#include <cmath>
+
+// ============================================================================
+// CONSTRUCTOR — Recorrido de (x, y) a (finX, finY)
+// ============================================================================
+PlataformaMovil::PlataformaMovil(float x, float y, float finX, float finY, float velocidad)
+    : Base(x, y)
+{
+    Inicio = { x, y };
+
+    float dx = finX - x;
+    float dy = finY - y;
+    Largo = std::sqrt(dx * dx + dy * dy);
+    Direccion = Largo > 0 ? Vector2{ dx / Largo, dy / Largo } : Vector2{ 0, 0 };
+
+    Velocidad = velocidad;
+    Recorrido = 0;
+    Sentido = 1;
+    Desplazamiento = { 0, 0 };
+}
+
+// ============================================================================
+// UPDATE — Movimiento de ida y vuelta
+// ============================================================================
+// La posición se calcula desde Inicio y la distancia recorrida (no se
+// acumula): así no deriva con el tiempo.
+void PlataformaMovil::Update(float dt)
+{
+    Recorrido += Sentido * Velocidad * dt;
+
+    // Rebote en los extremos
+    if (Recorrido > Largo)
+    {
+        Recorrido = Largo;
+        Sentido = -1;
+    }
+    else if (Recorrido < 0)
+    {
+        Recorrido = 0;
+        Sentido = 1;
+    }
+
+    Vector2 anterior = Base.Posicion;
+    Base.Posicion = { Inicio.x + Direccion.x * Recorrido, Inicio.y + Direccion.y * Recorrido };
+    Desplazamiento = { Base.Posicion.x - anterior.x, Base.Posicion.y - anterior.y };
+}
+
+// ============================================================================
+// DRAW / GetRect — Los de la plataforma base
+// ============================================================================
+void PlataformaMovil::Draw() const
+{
+    Base.Draw();
+}
+
+Rectangle PlataformaMovil::GetRect() const
+{
+    return Base.GetRect();
+}
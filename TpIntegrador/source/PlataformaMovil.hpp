@@ -0,0 +1,38 @@
+﻿#pragma once
+#include "raylib.h"
+#include "Plataforma.hpp"
+
+// ============================================================================
+// CLASE PLATAFORMA MÓVIL
+// ============================================================================
+// Plataforma cinemática que va y viene entre dos puntos a velocidad fija.
+// Se pisa como una de una vía y lleva al jugador que está parado encima
+// (el Nivel publica su desplazamiento del tick en el Mundo de colisión).
+// El dibujo y el rectángulo son los de una Plataforma común.
+// ============================================================================
+class PlataformaMovil
+{
+public:
+    Plataforma Base;                    // Sprite, escala y posición actual
+
+    Vector2 Inicio;                     // Extremos del recorrido
+    Vector2 Direccion;                  // Unitaria, de Inicio hacia Fin
+    float Largo;                        // Distancia entre los extremos
+    float Velocidad;                    // Píxeles por segundo
+
+    float Recorrido;                    // Distancia actual desde Inicio (0..Largo)
+    float Sentido;                      // +1 hacia Fin, -1 hacia Inicio
+    Vector2 Desplazamiento;             // Cuánto se movió en el último Update
+
+    // Constructor: arranca en (x, y) yendo hacia (finX, finY)
+    PlataformaMovil(float x, float y, float finX, float finY, float velocidad);
+
+    // Avanza por el recorrido y rebota en los extremos
+    void Update(float dt);
+
+    // Dibuja la plataforma en su posición actual
+    void Draw() const;
+
+    // Rectángulo de colisión en su posición actual
+    Rectangle GetRect() const;
+};
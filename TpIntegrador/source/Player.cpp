@@ -1,6 +1,5 @@
 #include "Player.hpp"
-#include "Plataforma.hpp"
-#include "Caja.hpp"
+#include "Nivel.hpp"
 #include "raylib.h"
 
 // ============================================================================
@@ -8,36 +7,18 @@
 // ============================================================================
 Player::Player()
 {
-    // Posicin inicial del personaje en el nivel
-    Posicion = { 25.0f, 568.0f };
-    Velocidad = { 0.0f, 0.0f };
-
     // Textura principal del personaje
-    TexturaCaballero = LoadTexture("Caballero.png");
-
-    // Direccin inicial: mirando a la derecha
-    MirandoDerecha = true;
+    TexturaCaballero = TEX_CABALLERO;
 
-    // Escala del sprite (tamao final en pantalla)
+    // Escala del sprite (tamaño final en pantalla)
     Escala = 0.15f;
 
-    // Dimensiones del jugador escalado
-    Ancho = TexturaCaballero.width * Escala;
-    Alto = TexturaCaballero.height * Escala;
-
-    // Estado fsico inicial
-    EnSuelo = false;
-    BufferSalto = 0;
-    ContadorSaltos = 0;
-
-    // CARGA DE SONIDOS
-    SonidoCaminarPasto = LoadSound("Caminando.mp3");
-    SonidoCaminarCaja = LoadSound("CaeCaja.mp3");
-    SonidoSaltoPasto = LoadSound("SaltoPasto.mp3");
-    SonidoSaltoCaja = LoadSound("SaltoCaja.mp3");
+    // Estado físico inicial con las dimensiones del jugador escalado
+    IniciarEstadoJugador(Fisica,
+        Recursos::AnchoCuadro(TexturaCaballero) * Escala,
+        Recursos::AltoCuadro(TexturaCaballero) * Escala);
 
-    // Tipo de superficie actual
-    TipoActual = SUELO_AIRE;
+    IniciarAnimacion(Animacion, CLIP_CABALLERO_QUIETO);
 
     // Tiempo entre pasos (para evitar spam de sonido)
     TimerPaso = 0;
@@ -45,181 +26,37 @@ Player::Player()
 }
 
 // ============================================================================
-// SALTO DEL JUGADOR
-// ============================================================================
-void Player::Jump()
-{
-    const float FuerzaSalto = 450.0f;
-
-    if (EnSuelo)
-    {
-        Velocidad.y = -FuerzaSalto;
-        EnSuelo = false;
-
-        // Sonido segn la superficie desde la que salt
-        if (TipoActual == SUELO_PASTO) PlaySound(SonidoSaltoPasto);
-        if (TipoActual == SUELO_CAJA) PlaySound(SonidoSaltoCaja);
-
-        ContadorSaltos++;
-    }
-}
-
-// ============================================================================
-// RECTNGULO DE COLISIN DEL JUGADOR
+// RECTÁNGULO DE COLISIÓN DEL JUGADOR
 // ============================================================================
 Rectangle Player::GetRect() const
 {
-    // Se recorta horizontalmente para ajustar mejor al sprite
-    float margen = Ancho * 0.26f;
-    return { Posicion.x + margen, Posicion.y, Ancho - margen * 2, Alto };
+    return RectJugador(Fisica);
 }
 
 // ============================================================================
 // UPDATE PRINCIPAL DEL JUGADOR
 // ============================================================================
-void Player::Update(float dt, const Rectangle& piso,
-    const std::vector<Plataforma*>& plataformas,
-    const std::vector<Caja*>& cajas)
+unsigned char Player::Update(float dt, const EntradaJugador& entrada, const Nivel& nivel)
 {
     TimerPaso += dt;
 
-    float velMov = 200.0f;
-    Velocidad.x = 0;
-
-    if (BufferSalto > 0) BufferSalto -= dt;
-
-    // --- MOVIMIENTO HORIZONTAL ---
-    bool moviendo = false;
-
-    if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT))
-    {
-        Velocidad.x = velMov;
-        MirandoDerecha = true;
-        moviendo = true;
-    }
-    if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT))
-    {
-        Velocidad.x = -velMov;
-        MirandoDerecha = false;
-        moviendo = true;
-    }
-
-    // Buffer para salto ms responsivo
-    if (IsKeyPressed(KEY_SPACE))
-        BufferSalto = 0.12f;
-
-    // Gravedad
-    if (!EnSuelo)
-        Velocidad.y += 900 * dt;
-
-    Rectangle r = GetRect();
-
-    // --- MOVER EN X ---
-    Posicion.x += Velocidad.x * dt;
-    r = GetRect();
-
-    // Colisin con plataformas
-    for (auto* p : plataformas)
-    {
-        Rectangle pr = p->GetRect();
-        if (CheckCollisionRecs(r, pr))
-        {
-            if (Velocidad.x > 0) Posicion.x = pr.x - Ancho;
-            else if (Velocidad.x < 0) Posicion.x = pr.x + pr.width;
-            r = GetRect();
-        }
-    }
-
-    // Colisin con cajas
-    for (auto* c : cajas)
-    {
-        Rectangle cr = c->GetRect();
-        if (CheckCollisionRecs(r, cr))
-        {
-            if (Velocidad.x > 0) Posicion.x = cr.x - Ancho;
-            else if (Velocidad.x < 0) Posicion.x = cr.x + cr.width;
-            r = GetRect();
-        }
-    }
-
-    // --- MOVER EN Y ---
-    EnSuelo = false;
-    TipoSuelo nuevoTipo = SUELO_AIRE;
-
-    Posicion.y += Velocidad.y * dt;
-    r = GetRect();
-
-    // Suelo principal
-    if (CheckCollisionRecs(r, piso))
-    {
-        EnSuelo = true;
-        nuevoTipo = SUELO_PASTO;
-        Velocidad.y = 0;
-        Posicion.y = piso.y - Alto;
-        r = GetRect();
-    }
+    // --- FÍSICA ---
+    unsigned char sucesos = PasoFisicoJugador(Fisica, entrada, dt, nivel);
 
-    // Colisin con plataformas
-    for (auto* p : plataformas)
+    // --- CADENCIA DE PASOS (evita spam de sonido) ---
+    if ((sucesos & PASO_CAMINANDO) && TimerPaso >= IntervaloPaso)
     {
-        Rectangle pr = p->GetRect();
-        if (CheckCollisionRecs(r, pr))
-        {
-            if (Velocidad.y > 0)
-            {
-                EnSuelo = true;
-                nuevoTipo = SUELO_PASTO;
-                Velocidad.y = 0;
-                Posicion.y = pr.y - Alto;
-            }
-            r = GetRect();
-        }
+        TimerPaso = 0;
+        sucesos |= PASO_PISADA;
     }
 
-    // Colisin con cajas
-    for (auto* c : cajas)
-    {
-        Rectangle cr = c->GetRect();
-        if (CheckCollisionRecs(r, cr))
-        {
-            if (Velocidad.y > 0)
-            {
-                EnSuelo = true;
-                nuevoTipo = SUELO_CAJA;
-                Velocidad.y = 0;
-                Posicion.y = cr.y - Alto;
-            }
-            r = GetRect();
-        }
-    }
+    // --- ANIMACIÓN ---
+    if (!Fisica.EnSuelo) CambiarClip(Animacion, CLIP_CABALLERO_SALTA);
+    else if (Fisica.Moviendo) CambiarClip(Animacion, CLIP_CABALLERO_CORRE);
+    else CambiarClip(Animacion, CLIP_CABALLERO_QUIETO);
 
-    TipoActual = nuevoTipo;
-
-    // --- Salto buffer ---
-    if (EnSuelo && BufferSalto > 0)
-    {
-        Jump();
-        BufferSalto = 0;
-    }
-
-    // --- SONIDO DE PASOS ---
-    if (EnSuelo && moviendo)
-    {
-        if (TimerPaso >= IntervaloPaso)
-        {
-            TimerPaso = 0;
-
-            if (TipoActual == SUELO_PASTO)
-                PlaySound(SonidoCaminarPasto);
-
-            if (TipoActual == SUELO_CAJA)
-                PlaySound(SonidoCaminarCaja);
-        }
-    }
-
-    // --- Limites pantalla ---
-    if (Posicion.x < 0) Posicion.x = 0;
-    if (Posicion.x > 1024 - Ancho) Posicion.x = 1024 - Ancho;
+    AvanzarAnimacion(Animacion, dt);
+    return sucesos;
 }
 
 // ============================================================================
@@ -227,15 +64,8 @@ void Player::Update(float dt, const Rectangle& piso,
 // ============================================================================
 void Player::Draw() const
 {
-    if (MirandoDerecha)
-        DrawTextureEx(TexturaCaballero, Posicion, 0, Escala, WHITE);
-    else
-    {
-        // Invertido horizontalmente
-        Rectangle src = { (float)TexturaCaballero.width, 0, -TexturaCaballero.width, (float)TexturaCaballero.height };
-        Rectangle dst = { Posicion.x, Posicion.y, TexturaCaballero.width * Escala, TexturaCaballero.height * Escala };
-        DrawTexturePro(TexturaCaballero, src, dst, { 0,0 }, 0, WHITE);
-    }
+    // Mirando a la izquierda: el mismo cuadro invertido horizontalmente
+    DibujarAnimacion(Animacion, Fisica.Posicion, Escala, !Fisica.MirandoDerecha);
 }
 
 // ============================================================================
@@ -243,23 +73,7 @@ void Player::Draw() const
 // ============================================================================
 void Player::Reiniciar()
 {
-    Posicion = { 25, 568 };
-    Velocidad = { 0, 0 };
-    EnSuelo = false;
-    ContadorSaltos = 0;
-    MirandoDerecha = true;
-    TipoActual = SUELO_AIRE;
+    IniciarEstadoJugador(Fisica, Fisica.Ancho, Fisica.Alto);
+    IniciarAnimacion(Animacion, CLIP_CABALLERO_QUIETO);
     TimerPaso = 0;
-}
-
-// ============================================================================
-// DESTRUCTOR  LIBERAR TEXTURAS Y SONIDOS
-// ============================================================================
-Player::~Player()
-{
-    UnloadTexture(TexturaCaballero);
-    UnloadSound(SonidoCaminarPasto);
-    UnloadSound(SonidoCaminarCaja);
-    UnloadSound(SonidoSaltoPasto);
-    UnloadSound(SonidoSaltoCaja);
 }
\ No newline at end of file
@@ -1,78 +1,54 @@
 #pragma once
 #include "raylib.h"
-#include <vector>
-#include "Plataforma.hpp"
+#include "Recursos.hpp"
+#include "FisicaJugador.hpp"
+#include "Animacion.hpp"
 
-class Plataforma;   // Declaraciones anticipadas para evitar includes pesados. 
-class Caja;         // (Las clases se definen en otros archivos)
+struct Nivel;       // Declaración anticipada para evitar includes pesados.
+                    // (Se define en Nivel.hpp)
 
 // ============================================================================
-// TIPO DE SUPERFICIE BAJO EL JUGADOR
+// CLASE PLAYER
 // ============================================================================
-// Permite saber si est pisando pasto, una caja o est en el aire.
-// Esto afecta sonidos y comportamiento de salto.
+// El estado físico vive en 'Fisica' (POD compacto que opera el paso de
+// física). Acá quedan solo los datos fríos: sprite y temporizadores.
 // ============================================================================
-enum TipoSuelo { SUELO_PASTO, SUELO_CAJA, SUELO_AIRE };
-
 class Player
 {
 public:
     // ========================================================================
-    // PROPIEDADES PRINCIPALES DEL PERSONAJE
+    // ESTADO FÍSICO (posición, velocidad, suelo, saltos)
     // ========================================================================
-    Vector2 Posicion;               // Posicin actual
-    Vector2 Velocidad;              // Velocidad en X/Y
-    float Ancho;                    // Dimensiones base del sprite escalado
-    float Alto;
-    bool EnSuelo;                   // Verdadero si est tocando alguna superficie
-    float BufferSalto;              // Permite "guardar" el salto por unos ms
-
-    Texture2D TexturaCaballero;     // Sprite del jugador
-    bool MirandoDerecha;            // Para espejar el sprite
-
-    float Escala;                   // Tamao del sprite
-
-    int ContadorSaltos;             // Para perder si se pasa de 10
+    EstadoJugador Fisica;
 
     // ========================================================================
-    // SONIDOS DEL JUGADOR
+    // RENDER
     // ========================================================================
-    Sound SonidoCaminarPasto;
-    Sound SonidoCaminarCaja;
-    Sound SonidoSaltoPasto;
-    Sound SonidoSaltoCaja;
+    IdTextura TexturaCaballero;     // Sprite del jugador (identificador en Recursos)
+    float Escala;                   // Tamaño del sprite
+    EstadoAnimacion Animacion;      // Quieto / corre / salta, según la física
 
     // ========================================================================
-    // SONIDOS DEL JUGADOR
+    // CADENCIA DE PASOS (cada cuánto una pisada es un EV_PISADA)
     // ========================================================================
     float TimerPaso;
     float IntervaloPaso;
 
-    // Tipo de superficie donde est parado actualmente
-    TipoSuelo TipoActual;
-
     // ========================================================================
-    // MTODOS PRINCIPALES
+    // MÉTODOS PRINCIPALES
     // ========================================================================
     Player();   // Constructor
 
-    // Actualiza movimiento, gravedad, colisiones y sonidos
-    void Update(float dt, const Rectangle& piso,
-                const std::vector<Plataforma*>& plataformas,
-                const std::vector<Caja*>& cajas);
+    // Avanza la física un paso y elige la animación. Es determinista: no
+    // lee raylib ni dispara sonidos; devuelve los SucesoPaso del paso
+    unsigned char Update(float dt, const EntradaJugador& entrada, const Nivel& nivel);
 
-    // Dibuja el sprite con orientacin correcta
+    // Dibuja el cuadro actual con orientación correcta
     void Draw() const;
 
-    // Lgica interna de salto
-    void Jump();
-
-    // Rectngulo de colisin del jugador
+    // Rectángulo de colisión del jugador
     Rectangle GetRect() const;
 
     // Restablece valores para reintentar
     void Reiniciar();
-
-    // Libera recursos
-    ~Player();
 };
\ No newline at end of file
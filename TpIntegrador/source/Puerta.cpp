@@ -2,26 +2,27 @@
 #include "raylib.h"
 
 // ============================================================================
-// CONSTRUCTOR: carga texturas y define posicin base
+// CONSTRUCTOR: asigna texturas y define posición base
 // ============================================================================
 Puerta::Puerta()
 {
-	TexturaCerrada = LoadTexture("PuertaCerrada.png");		// Sprite puerta cerrada
-	TexturaAbierta = LoadTexture("PuertaAbierta.png");		// Sprite puerta abierta
-	TextDialogo = LoadTexture("Dialogo.png");				// Cuadro de dilogo
+	TexturaCerrada = TEX_PUERTA_CERRADA;		// Sprite puerta cerrada
+	TexturaAbierta = TEX_PUERTA_ABIERTA;		// Sprite puerta abierta
+	TextDialogo = TEX_DIALOGO;					// Cuadro de diálogo
 
 	Escala = 1.2f;
 
-	// Ubicacin exacta segn diseo (ajustada por la altura escalada)
-	float AlturaEscalada = TexturaCerrada.height * Escala;
+	// Ubicación exacta según diseño (ajustada por la altura escalada)
+	float AlturaEscalada = Recursos::Alto(TexturaCerrada) * Escala;
 
 	Posicion = { 325.0f, 300.0f - AlturaEscalada };
+	Rect = { Posicion.x, Posicion.y, Recursos::Ancho(TexturaCerrada) * Escala, AlturaEscalada };
 
 	EstaAbierta = false;		// Estado inicial
-	MostrarDialogo = false;		// El dilogo solo aparece si el jugador est cerca
+	MostrarDialogo = false;		// El diálogo solo aparece si el jugador está cerca
 }
 
-// Asignacin de fuente para escribir dentro del cuadro de dilogo
+// Asignación de fuente para escribir dentro del cuadro de diálogo
 void Puerta::SetFont(Font f)
 {
 	PixelFont = f;
@@ -30,26 +31,22 @@ void Puerta::SetFont(Font f)
 // Devuelve la hitbox exacta de la puerta
 Rectangle Puerta::GetRect() const
 {
-	return { Posicion.x, Posicion.y, TexturaCerrada.width * Escala, TexturaCerrada.height * Escala };
+	return Rect;
 }
 
 // ============================================================================
-// Interaccin para abrir la puerta
-// - Solo aparece el dilogo si el jugador est cerca
+// Interacción para abrir la puerta
+// - Solo aparece el diálogo si el jugador está cerca
 // - Solo abre si se hace *click directamente sobre ella*
 // ============================================================================
-void Puerta::IntAbrir(const Rectangle& RectJugador)
+void Puerta::IntAbrir(bool JugadorCerca, Vector2 mouse, bool click)
 {
-	if (CheckCollisionRecs(RectJugador,GetRect()))
+	if (JugadorCerca)
 	{
-		MostrarDialogo = !EstaAbierta;		// Mostrar Haz click solo si est cerrada
-
-		Vector2 mouse = GetMousePosition();
-		Rectangle rectPuerta = GetRect();
+		MostrarDialogo = !EstaAbierta;		// Mostrar “Haz click…” solo si está cerrada
 
 		// Click EXACTO encima de la puerta para abrir
-		if (CheckCollisionPointRec(mouse, rectPuerta) &&
-			IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
+		if (CheckCollisionPointRec(mouse, Rect) && click)
 		{
 			EstaAbierta = true;
 			MostrarDialogo = false;
@@ -57,35 +54,35 @@ void Puerta::IntAbrir(const Rectangle& RectJugador)
 	}
 	else
 	{
-		MostrarDialogo = false;		// Si el jugador se aleja, se oculta el dilogo
+		MostrarDialogo = false;		// Si el jugador se aleja, se oculta el diálogo
 	}
 }
 
 // ============================================================================
-// Dibujo de la puerta y su cuadro de interaccin
+// Dibujo de la puerta y su cuadro de interacción
 // ============================================================================
 void Puerta::Draw() const
 {
-	// Sprite segn estado
+	// Sprite según estado
 	if (EstaAbierta)
-		DrawTextureEx(TexturaAbierta, Posicion, 0, Escala, WHITE);
+		DrawTextureEx(Recursos::Textura(TexturaAbierta), Posicion, 0, Escala, WHITE);
 	else
-		DrawTextureEx(TexturaCerrada, Posicion, 0, Escala, WHITE);
+		DrawTextureEx(Recursos::Textura(TexturaCerrada), Posicion, 0, Escala, WHITE);
 
-	// Cuadro Haz click para abrir la puerta
+	// Cuadro “Haz click para abrir la puerta”
 	if (MostrarDialogo)
 	{
 		float escalaDialogo = 0.40f;
 
-		float dw = TextDialogo.width * escalaDialogo;
-		float dh = TextDialogo.height * escalaDialogo;
+		float dw = Recursos::Ancho(TextDialogo) * escalaDialogo;
+		float dh = Recursos::Alto(TextDialogo) * escalaDialogo;
 
-		// Posicin del cuadro, centrado respecto a la puerta
+		// Posición del cuadro, centrado respecto a la puerta
 		Vector2 posDialogo;
 		posDialogo.x = Posicion.x - 180;
 		posDialogo.y = Posicion.y - dh;
 
-		DrawTextureEx(TextDialogo, posDialogo, 0, escalaDialogo, WHITE);
+		DrawTextureEx(Recursos::Textura(TextDialogo), posDialogo, 0, escalaDialogo, WHITE);
 
 		// Texto dentro del cuadro
 		const char* texto = "Haz click para abrir la puerta";
@@ -101,14 +98,4 @@ void Puerta::Draw() const
 
 		DrawTextEx(PixelFont, texto, posTexto, fontSize, spacing, BLACK);
 	}
-}
-
-// ============================================================================
-// Destructor: libera texturas
-// ============================================================================
-Puerta::~Puerta()	
-{
-	UnloadTexture(TexturaCerrada);
-	UnloadTexture(TexturaAbierta);
-	UnloadTexture(TextDialogo);
 }
\ No newline at end of file
@@ -1,26 +1,31 @@
 #pragma once
 #include "raylib.h"
+#include "Recursos.hpp"
 
 // ============================================================================
 // CLASE PUERTA
 // ============================================================================
 // Representa la puerta final del nivel. Puede estar abierta o cerrada,
-// muestra un cuadro de dilogo cuando el jugador est cerca
+// muestra un cuadro de diálogo cuando el jugador está cerca
 // y permite detectar clic para abrirla.
+// Es un dato plano: las texturas las guarda el gestor de Recursos.
 // ============================================================================
 class Puerta
 {
 public:
 
-	// Posicin en el mundo
+	// Posición en el mundo
 	Vector2 Posicion;
 
-	// Texturas de la puerta y el cuadro de dilogo
-	Texture2D TexturaCerrada;
-	Texture2D TexturaAbierta;
-	Texture2D TextDialogo;
+	// Hitbox (la puerta no se mueve: se calcula una sola vez en el constructor)
+	Rectangle Rect;
 
-	// Estados de interaccin
+	// Texturas de la puerta y el cuadro de diálogo
+	IdTextura TexturaCerrada;
+	IdTextura TexturaAbierta;
+	IdTextura TextDialogo;
+
+	// Estados de interacción
 	bool EstaAbierta;		// Se activa cuando el jugador la abre
 	bool MostrarDialogo;	// Muestra mensaje "haz click para abrir"
 
@@ -29,13 +34,11 @@ public:
 	Font PixelFont;
 
 	// =========================================================================
-	// MTODOS PRINCIPALES
+	// MÉTODOS PRINCIPALES
 	// =========================================================================
-	Puerta();							// Carga texturas y configura el estado inicial
+	Puerta();							// Asigna texturas y configura el estado inicial
 	void SetFont(Font f);				// Fuente usada para el mensaje emergente
-	void Draw() const;					// Dibuja la puerta + cuadro de dilogo si corresponde
-	Rectangle GetRect() const;			// Hitbox para detectar proximidad del jugador
-	void IntAbrir(const Rectangle& RectJugador);	// Lgica de interaccin (hover + clic)
-
-	~Puerta();			// Libera texturas cargadas
+	void Draw() const;					// Dibuja la puerta + cuadro de diálogo si corresponde
+	Rectangle GetRect() const;			// Hitbox (el Nivel la carga como disparador en su Mundo)
+	void IntAbrir(bool JugadorCerca, Vector2 mouse, bool click);	// Lógica de interacción (hover + clic)
 };
\ No newline at end of file
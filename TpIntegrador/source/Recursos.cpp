@@ -0,0 +1,134 @@
+﻿#include "Recursos.hpp"
+#include "raylib.h"
+
+// ============================================================================
+// RUTAS DE CADA RECURSO (en el mismo orden que los enums)
+// ============================================================================
+static const char* RutasTexturas[TEX_CANTIDAD] = {
+    "PisoFlotante.png",     // TEX_PLATAFORMA
+    "Caja.png",             // TEX_CAJA
+    "Murcielago.png",       // TEX_MURCIELAGO
+    "Caballero.png",        // TEX_CABALLERO
+    "PuertaCerrada.png",    // TEX_PUERTA_CERRADA
+    "PuertaAbierta.png",    // TEX_PUERTA_ABIERTA
+    "Dialogo.png",          // TEX_DIALOGO
+    "Suelo.png",            // TEX_SUELO
+    "Pinchos.png"           // TEX_PINCHOS
+};
+
+// ============================================================================
+// GRILLA DE CADA HOJA (columnas x filas de cuadros, mismo orden)
+// ============================================================================
+struct GrillaHoja
+{
+    unsigned char Columnas;
+    unsigned char Filas;
+};
+
+static const GrillaHoja Grillas[TEX_CANTIDAD] = {
+    { 1, 1 },   // TEX_PLATAFORMA
+    { 1, 1 },   // TEX_CAJA
+    { 1, 1 },   // TEX_MURCIELAGO
+    { 1, 1 },   // TEX_CABALLERO
+    { 1, 1 },   // TEX_PUERTA_CERRADA
+    { 1, 1 },   // TEX_PUERTA_ABIERTA
+    { 1, 1 },   // TEX_DIALOGO
+    { 1, 1 },   // TEX_SUELO
+    { 1, 1 }    // TEX_PINCHOS
+};
+
+// ============================================================================
+// ALMACENAMIENTO (arreglos fijos, sin reservas dinámicas)
+// ============================================================================
+static Texture2D Texturas[TEX_CANTIDAD] = {};
+static Vector2 Tamanios[TEX_CANTIDAD] = {};
+static bool EnGPU = false;
+static int Contados[REC_CANTIDAD] = {};     // Recursos vivos por tipo
+
+void Recursos::Cargar()
+{
+    for (int i = 0; i < TEX_CANTIDAD; i++)
+    {
+        Texturas[i] = LoadTexture(RutasTexturas[i]);
+        if (Texturas[i].id > 0) Anotar(REC_TEXTURA, 1);
+        Tamanios[i] = { (float)Texturas[i].width, (float)Texturas[i].height };
+    }
+
+    EnGPU = true;
+}
+
+void Recursos::CargarSinVentana()
+{
+    // Se decodifica cada imagen solo para conocer su tamaño y se descarta
+    for (int i = 0; i < TEX_CANTIDAD; i++)
+    {
+        Image img = LoadImage(RutasTexturas[i]);
+        Tamanios[i] = { (float)img.width, (float)img.height };
+        UnloadImage(img);
+    }
+
+    EnGPU = false;
+}
+
+void Recursos::Liberar()
+{
+    if (EnGPU)
+        for (int i = 0; i < TEX_CANTIDAD; i++)
+        {
+            if (Texturas[i].id > 0) Anotar(REC_TEXTURA, -1);
+            UnloadTexture(Texturas[i]);
+        }
+
+    for (int i = 0; i < TEX_CANTIDAD; i++) Texturas[i] = {};
+
+    EnGPU = false;
+}
+
+bool Recursos::HayGPU()
+{
+    return EnGPU;
+}
+
+const Texture2D& Recursos::Textura(IdTextura id)
+{
+    return Texturas[id];
+}
+
+float Recursos::Ancho(IdTextura id)
+{
+    return Tamanios[id].x;
+}
+
+float Recursos::Alto(IdTextura id)
+{
+    return Tamanios[id].y;
+}
+
+float Recursos::AnchoCuadro(IdTextura id)
+{
+    return Tamanios[id].x / Grillas[id].Columnas;
+}
+
+float Recursos::AltoCuadro(IdTextura id)
+{
+    return Tamanios[id].y / Grillas[id].Filas;
+}
+
+void Recursos::Anotar(TipoRecurso tipo, int cambio)
+{
+    Contados[tipo] += cambio;
+}
+
+int Recursos::Vivos(TipoRecurso tipo)
+{
+    return Contados[tipo];
+}
+
+Rectangle Recursos::Cuadro(IdTextura id, int celda)
+{
+    float ancho = AnchoCuadro(id);
+    float alto = AltoCuadro(id);
+    int columna = celda % Grillas[id].Columnas;
+    int fila = celda / Grillas[id].Columnas;
+    return { columna * ancho, fila * alto, ancho, alto };
+}
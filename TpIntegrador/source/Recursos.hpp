@@ -0,0 +1,95 @@
+﻿#pragma once
+#include "raylib.h"
+
+// ============================================================================
+// IDENTIFICADORES DE RECURSOS
+// ============================================================================
+// Las entidades del juego no guardan texturas ni sonidos: guardan uno de
+// estos identificadores y piden el recurso al gestor al momento de dibujar
+// o reproducir. Así siguen siendo datos planos (copiables sin riesgo y
+// utilizables en simulaciones sin ventana).
+// ============================================================================
+enum IdTextura : unsigned char
+{
+    TEX_PLATAFORMA,
+    TEX_CAJA,
+    TEX_MURCIELAGO,
+    TEX_CABALLERO,
+    TEX_PUERTA_CERRADA,
+    TEX_PUERTA_ABIERTA,
+    TEX_DIALOGO,
+    TEX_SUELO,
+    TEX_PINCHOS,
+    TEX_CANTIDAD
+};
+
+enum IdSonido : unsigned char
+{
+    SND_CAMINAR_PASTO,
+    SND_CAMINAR_CAJA,
+    SND_SALTO_PASTO,
+    SND_SALTO_CAJA,
+    SND_BOTON,
+    SND_TOCA_BOTON,
+    SND_PIERDE,
+    SND_GANASTE,
+    SND_CANTIDAD
+};
+
+// ============================================================================
+// GESTOR DE RECURSOS
+// ============================================================================
+// Único dueño de las texturas de las entidades.
+// Se cargan una sola vez al iniciar y se liberan una sola vez al salir.
+// Los sonidos (IdSonido) los administra el pool de voces de Audio.hpp.
+// ============================================================================
+namespace Recursos
+{
+    // Carga texturas en GPU (requiere InitWindow)
+    void Cargar();
+
+    // Solo lee las dimensiones de cada imagen, sin GPU.
+    // Pensado para simulaciones por lotes y herramientas sin ventana.
+    void CargarSinVentana();
+
+    // Libera todo lo cargado
+    void Liberar();
+
+    // true si las texturas están en GPU (Cargar); false sin ventana
+    bool HayGPU();
+
+    // Acceso por identificador
+    const Texture2D& Textura(IdTextura id);
+
+    // Dimensiones originales de la imagen (válidas también sin ventana)
+    float Ancho(IdTextura id);
+    float Alto(IdTextura id);
+
+    // Hojas de sprites: cada textura es una grilla de cuadros del mismo
+    // tamaño, numerados fila por fila (un dibujo suelto es una grilla 1x1)
+    Rectangle Cuadro(IdTextura id, int celda);
+    float AnchoCuadro(IdTextura id);
+    float AltoCuadro(IdTextura id);
+}
+
+// ============================================================================
+// RECURSOS VIVOS
+// ============================================================================
+// Cada lugar que carga o descarga una textura, malla o sonido lo anota acá.
+// Con el juego abierto los números tienen que quedar quietos: si suben con
+// las horas (pruebas de resistencia con --bot), algo carga sin liberar.
+// Solo del hilo principal.
+// ============================================================================
+enum TipoRecurso : unsigned char
+{
+    REC_TEXTURA,                // Texturas, fuentes y render textures
+    REC_MALLA,                  // Mallas subidas a la GPU (bloques de tiles)
+    REC_SONIDO,                 // Voces del pool y música
+    REC_CANTIDAD
+};
+
+namespace Recursos
+{
+    void Anotar(TipoRecurso tipo, int cambio);
+    int Vivos(TipoRecurso tipo);
+}
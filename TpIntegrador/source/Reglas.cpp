@@ -0,0 +1,36 @@
+﻿#include "Reglas.hpp"
+#include "Nivel.hpp"
+#include "raylib.h"
+
+// ============================================================================
+// CONDICIONES DE DERROTA
+// ============================================================================
+MotivoPerdida ComprobarDerrota(const EstadoJugador& jugador, const Nivel& nivel, float tiempoJugado)
+{
+    Rectangle rectJugador = RectJugador(jugador);
+
+    // --- Perder por contacto (pinchos, murciélagos y cualquier otro peligro) ---
+    // Una sola consulta; cada colisionador trae su MotivoPerdida en Dato
+    // y gana el de mayor número, como en el orden de chequeo original.
+    int contactos[MaxContactos];
+    int numContactos = ConsultarMundo(nivel.Mundo, rectJugador, COL_PELIGRO | COL_ENEMIGO,
+        contactos, MaxContactos);
+
+    int motivo = SIN_PERDIDA;
+    for (int k = 0; k < numContactos; k++)
+        if (nivel.Mundo.Datos[contactos[k]] > motivo)
+            motivo = nivel.Mundo.Datos[contactos[k]];
+
+    if (motivo != SIN_PERDIDA)
+        return (MotivoPerdida)motivo;
+
+    // --- Perder por límite de tiempo ---
+    if (tiempoJugado >= TiempoLimite)
+        return PERDIDA_TIEMPO;
+
+    // --- Perder por saltos ---
+    if (jugador.ContadorSaltos > MaxSaltos)
+        return PERDIDA_SALTOS;
+
+    return SIN_PERDIDA;
+}
@@ -0,0 +1,28 @@
+﻿#pragma once
+#include "raylib.h"
+#include "FisicaJugador.hpp"
+
+struct Nivel;       // Declaración anticipada (se define en Nivel.hpp)
+
+// ============================================================================
+// REGLAS DE LA PARTIDA
+// ============================================================================
+// Límites del desafío y motivos por los que se puede perder.
+// Los valores de MotivoPerdida son los que muestra la pantalla PERDISTE.
+// ============================================================================
+const int MaxSaltos = 10;           // Se pierde al superar esta cantidad de saltos
+const float TiempoLimite = 20.0f;   // Segundos disponibles para abrir la puerta
+
+enum MotivoPerdida
+{
+    SIN_PERDIDA = 0,
+    PERDIDA_SALTOS = 1,         // Saltaste demasiado
+    PERDIDA_TIEMPO = 2,         // Te quedaste sin tiempo
+    PERDIDA_MURCIELAGO = 3,     // Te mordió un murciélago
+    PERDIDA_PINCHOS = 4         // Caíste en las trampas
+};
+
+// Evalúa todas las condiciones de derrota del frame.
+// Si se cumplen varias, gana la de mayor número (igual que el orden original
+// de chequeo: saltos, tiempo, murciélagos y por último pinchos).
+MotivoPerdida ComprobarDerrota(const EstadoJugador& jugador, const Nivel& nivel, float tiempoJugado);
@@ -0,0 +1,465 @@
+﻿#include "raylib.h"         // Ventana oculta y contexto GL
+#include "rlgl.h"           // Batch propio para contar draw calls
+#include "Recursos.hpp"     // Texturas compartidas por las entidades
+#include "Entrada.hpp"      // Sesiones grabadas
+#include "Juego.hpp"        // El mismo código de pantallas que el juego
+#include "Instanciado.hpp"  // Conteo de llamadas de dibujo del frame
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// ARNÉS DE REGRESIÓN DE FRAMES
+// ============================================================================
+// Reproduce un conjunto fijo de sesiones grabadas sobre el juego real
+// (Juego::Frame), dibujando en una ventana oculta, y mide por frame:
+//   - tiempo de CPU de actualizar + dibujar + enviar el batch a la GPU
+//   - cantidad de draw calls: las del batch de rlgl (también las de los
+//     vaciados a mitad del frame) más DrawMesh y las instanciadas
+// Falla (código 1) si el p95 del tiempo o el máximo de draw calls de alguna
+// sesión supera su umbral guardado, o si una sesión ya no termina donde
+// se esperaba (por ejemplo, un cambio de física hace que la partida
+// ganadora ya no llegue a la puerta).
+//
+// Uso:
+//   RegresionFrames [--sesiones carpeta] [--umbrales Umbrales.json]
+//                   [--guardar-umbrales Umbrales.json] [--margen 0.5]
+//                   [--generar-sesiones]
+//
+// Las draw calls no dependen de la máquina, pero los tiempos sí: el
+// Sesiones/Umbrales.json del repositorio solo fija draw calls (una sesión
+// sin "p95_ms" no controla tiempo). Para controlar también el p95 se
+// genera un archivo con --guardar-umbrales en la máquina donde se compara.
+//
+// --generar-sesiones vuelve a escribir las sesiones a partir de los
+// guiones de abajo. También se puede reemplazar cualquier .ent por una
+// partida real grabada con "TpIntegrador --grabar archivo.ent".
+// ============================================================================
+
+static const float DtFijo = 1.0f / 60.0f;
+
+// ============================================================================
+// GUIONES DE LAS SESIONES
+// ============================================================================
+// Cada guion arma la entrada frame por frame, a 60 FPS fijos. Los pulsos
+// (salto, click, R, M) van solo en el primer frame del tramo.
+// ============================================================================
+class Guion
+{
+public:
+    std::vector<EntradaFrame> Frames;
+    Vector2 Mouse = { 0, 0 };
+
+    // Mantiene 'botones' durante 'frames' frames
+    Guion& Mantener(int frames, unsigned short botones = 0)
+    {
+        for (int i = 0; i < frames; i++)
+            Frames.push_back({ DtFijo, Mouse, botones, 0 });
+        return *this;
+    }
+
+    // Un frame con un pulso (más las teclas que se sigan manteniendo)
+    Guion& Pulsar(unsigned short pulso, unsigned short mantenidos = 0)
+    {
+        return Mantener(1, (unsigned short)(pulso | mantenidos));
+    }
+
+    // Mueve el cursor en línea recta durante 'frames' frames
+    Guion& MoverMouse(Vector2 destino, int frames)
+    {
+        Vector2 origen = Mouse;
+        for (int i = 1; i <= frames; i++)
+        {
+            float t = (float)i / frames;
+            Mouse = { origen.x + (destino.x - origen.x) * t, origen.y + (destino.y - origen.y) * t };
+            Mantener(1);
+        }
+        return *this;
+    }
+
+    Guion& Click(Vector2 punto)
+    {
+        Mouse = punto;
+        return Pulsar(ENT_CLICK);
+    }
+};
+
+// Puntos de la interfaz (centros de los botones y de la puerta)
+static const Vector2 BotonPlay = { 512, 441 };
+static const Vector2 BotonExit = { 512, 541 };
+static const Vector2 BotonReintentar = { 530, 437 };
+static const Vector2 BotonMenu = { 530, 487 };
+static const Vector2 CentroPuerta = { 373, 247 };
+
+static const unsigned short Der = ENT_DERECHA;
+static const unsigned short Izq = ENT_IZQUIERDA;
+
+// Pasea por el menú, pasa por encima de los botones y sale con EXIT
+static void GuionMenu(Guion& g)
+{
+    g.Mouse = { 100, 100 };
+    g.Mantener(30);
+    g.MoverMouse(BotonPlay, 40).Mantener(30);
+    g.MoverMouse({ 900, 300 }, 40).Pulsar(ENT_CONTROLES).Mantener(20);
+    g.MoverMouse(BotonExit, 40).Mantener(30);
+    g.MoverMouse(BotonPlay, 20).MoverMouse(BotonExit, 20).Mantener(20);
+    g.Click(BotonExit);
+}
+
+// Partida completa: sube por plataformas y caja esquivando los murciélagos,
+// abre la puerta y espera en la pantalla GANASTE
+static void GuionVictoria(Guion& g)
+{
+    g.Click(BotonPlay);
+
+    g.Mantener(21, Der).Pulsar(ENT_SALTO, Der).Mantener(72, Der);              // Suelo → plataforma 1
+    g.Pulsar(ENT_SALTO, Der).Mantener(48, Der);                                 // → plataforma 2
+    g.Pulsar(ENT_SALTO, Der).Mantener(25, Der).Mantener(36);                    // Salta por encima del murciélago
+    g.Mantener(13, Der).Pulsar(ENT_SALTO, Der).Mantener(50, Der);               // → plataforma 3
+    g.Pulsar(ENT_SALTO, Der).Mantener(46, Der).Mantener(17);                    // → caja
+    g.Mantener(116).Mantener(13, Izq);                                          // Espera al murciélago de arriba
+    g.Pulsar(ENT_SALTO, Izq).Mantener(36, Izq).Mantener(9);                     // → plataforma 4
+    g.Mantener(24, Izq).Pulsar(ENT_SALTO, Izq).Mantener(74, Izq).Mantener(27);  // → plataforma 5 (puerta)
+
+    g.MoverMouse(CentroPuerta, 10).Click(CentroPuerta);
+    g.Mantener(60 + 120);   // Transición + pantalla GANASTE
+}
+
+// Sube a la plataforma 1 y camina hasta caer en los pinchos
+static void GuionPinchos(Guion& g)
+{
+    g.Click(BotonPlay);
+    g.Mantener(20, Der).Pulsar(ENT_SALTO, Der).Mantener(30, Der);
+    g.Mantener(90, Der);
+    g.Mantener(60 + 30);
+    g.MoverMouse(BotonReintentar, 30).Mantener(30).MoverMouse(BotonMenu, 30).Mantener(30);
+}
+
+// Se queda quieto hasta que se termina el tiempo
+static void GuionTiempo(Guion& g)
+{
+    g.Click(BotonPlay);
+    g.Mantener((int)(TiempoLimite * 60) + 10);
+    g.Mantener(60 + 60);
+}
+
+// Salta en el lugar hasta pasarse del límite de saltos
+static void GuionSaltos(Guion& g)
+{
+    g.Click(BotonPlay);
+    for (int i = 0; i <= MaxSaltos; i++)
+        g.Pulsar(ENT_SALTO).Mantener(64);
+    g.Mantener(60 + 60);
+}
+
+// Salta de la plataforma 1 a la 2 justo cuando pasa el murciélago
+static void GuionMurcielago(Guion& g)
+{
+    g.Click(BotonPlay);
+    g.Mantener(20, Der).Pulsar(ENT_SALTO, Der).Mantener(30, Der);
+    g.Mantener(98).Mantener(44, Der);
+    g.Pulsar(ENT_SALTO, Der).Mantener(50, Der);
+    g.Mantener(60 + 60);
+}
+
+// Reinicios rápidos con R en medio de la partida
+static void GuionReinicios(Guion& g)
+{
+    g.Click(BotonPlay);
+    for (int i = 0; i < 40; i++)
+    {
+        g.Mantener(6, Der).Pulsar(ENT_SALTO, Der).Mantener(6, Der);
+        g.Pulsar(ENT_REINICIAR);
+    }
+}
+
+// ============================================================================
+// TABLA DE SESIONES
+// ============================================================================
+struct Sesion
+{
+    const char* Nombre;
+    void (*Armar)(Guion&);
+    EstadoJuego EstadoFinal;    // Donde debe terminar la sesión
+    MotivoPerdida MotivoFinal;
+    bool Sale;                  // Termina eligiendo EXIT
+};
+
+static const Sesion Sesiones[] = {
+    { "menu",       GuionMenu,       MENU,     SIN_PERDIDA,        true  },
+    { "victoria",   GuionVictoria,   GANASTE,  SIN_PERDIDA,        false },
+    { "pinchos",    GuionPinchos,    PERDISTE, PERDIDA_PINCHOS,    false },
+    { "tiempo",     GuionTiempo,     PERDISTE, PERDIDA_TIEMPO,     false },
+    { "saltos",     GuionSaltos,     PERDISTE, PERDIDA_SALTOS,     false },
+    { "murcielago", GuionMurcielago, PERDISTE, PERDIDA_MURCIELAGO, false },
+    { "reinicios",  GuionReinicios,  JUGANDO,  SIN_PERDIDA,        false }
+};
+
+static std::string RutaSesion(const char* carpeta, const char* nombre)
+{
+    return std::string(carpeta) + "/" + nombre + ".ent";
+}
+
+// ============================================================================
+// RESULTADOS Y UMBRALES
+// ============================================================================
+struct ResultadoSesion
+{
+    std::string Nombre;
+    int Frames;
+    double MediaMs;
+    double P95Ms;
+    double MaxMs;
+    int MaxDraws;
+};
+
+struct UmbralSesion
+{
+    std::string Nombre;
+    double P95Ms;               // 0: sin umbral de tiempo
+    int MaxDraws;
+};
+
+static double Percentil(std::vector<double> valores, double p)
+{
+    if (valores.empty()) return 0;
+    std::sort(valores.begin(), valores.end());
+    size_t i = (size_t)(p * (valores.size() - 1) + 0.5);
+    return valores[i];
+}
+
+static bool GuardarUmbrales(const char* ruta, const std::vector<ResultadoSesion>& resultados, double margen)
+{
+    FILE* f = std::fopen(ruta, "w");
+    if (!f) return false;
+
+    std::fprintf(f, "{\n  \"umbrales\": [\n");
+    for (size_t i = 0; i < resultados.size(); i++)
+    {
+        const ResultadoSesion& r = resultados[i];
+        // Al menos 0.001: con tres decimales un p95 muy chico quedaría en 0 (sin umbral)
+        double p95 = r.P95Ms * (1.0 + margen);
+        std::fprintf(f, "    { \"sesion\": \"%s\", \"p95_ms\": %.3f, \"max_draws\": %d }%s\n",
+            r.Nombre.c_str(), p95 > 0.001 ? p95 : 0.001, r.MaxDraws,
+            i + 1 < resultados.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+
+    std::fclose(f);
+    return true;
+}
+
+// Lee un archivo escrito por GuardarUmbrales (un umbral por línea; el
+// p95 puede faltar)
+static bool LeerUmbrales(const char* ruta, std::vector<UmbralSesion>& umbrales)
+{
+    FILE* f = std::fopen(ruta, "r");
+    if (!f) return false;
+
+    char linea[512];
+    while (std::fgets(linea, sizeof(linea), f))
+    {
+        char nombre[64];
+        double p95;
+        int draws;
+        if (std::sscanf(linea, " { \"sesion\": \"%63[^\"]\", \"p95_ms\": %lf, \"max_draws\": %d",
+            nombre, &p95, &draws) == 3)
+            umbrales.push_back({ nombre, p95, draws });
+        else if (std::sscanf(linea, " { \"sesion\": \"%63[^\"]\", \"max_draws\": %d", nombre, &draws) == 2)
+            umbrales.push_back({ nombre, 0, draws });
+    }
+
+    std::fclose(f);
+    return true;
+}
+
+// ============================================================================
+// REPRODUCCIÓN DE UNA SESIÓN
+// ============================================================================
+// Devuelve false si la sesión no terminó en el estado esperado.
+static bool ReproducirSesion(const Sesion& s, const std::vector<EntradaFrame>& frames,
+    ResultadoSesion& r)
+{
+    using Reloj = std::chrono::steady_clock;
+
+    Juego juego;
+    if (!juego.Iniciar())
+    {
+        juego.Liberar();
+        return false;
+    }
+
+    std::vector<double> tiempos;
+    tiempos.reserve(frames.size());
+    int maxDraws = 0;
+    bool salio = false;
+    Instanciado::TomarLlamadas();       // Lo que dibujó Iniciar no es de ningún frame
+
+    for (const EntradaFrame& entrada : frames)
+    {
+        BeginDrawing();
+        Reloj::time_point inicio = Reloj::now();
+
+        bool seguir = juego.Frame(entrada);
+
+        // Las entradas del batch se cuentan cada vez que se vacía (también
+        // a mitad del frame). (Solo es exacto mientras un frame no llene el
+        // batch: 256 cambios de textura o 8192 quads lo vacían sin contar.)
+        Instanciado::VaciarLote();
+        int draws = Instanciado::TomarLlamadas();
+
+        Reloj::duration transcurrido = Reloj::now() - inicio;
+        EndDrawing();   // Intercambio de buffers: fuera de la medición
+
+        tiempos.push_back(std::chrono::duration<double, std::milli>(transcurrido).count());
+        if (draws > maxDraws) maxDraws = draws;
+
+        if (!seguir)
+        {
+            salio = true;
+            break;
+        }
+    }
+
+    double suma = 0;
+    for (double t : tiempos) suma += t;
+
+    r.Nombre = s.Nombre;
+    r.Frames = (int)tiempos.size();
+    r.MediaMs = tiempos.empty() ? 0 : suma / tiempos.size();
+    r.P95Ms = Percentil(tiempos, 0.95);
+    r.MaxMs = tiempos.empty() ? 0 : *std::max_element(tiempos.begin(), tiempos.end());
+    r.MaxDraws = maxDraws;
+
+    bool esperado = juego.Estado == s.EstadoFinal && juego.Motivo == s.MotivoFinal && salio == s.Sale;
+    if (!esperado)
+        std::fprintf(stderr, "%-12s terminó en estado %d / motivo %d (se esperaba %d / %d)\n",
+            s.Nombre, (int)juego.Estado, (int)juego.Motivo, (int)s.EstadoFinal, (int)s.MotivoFinal);
+
+    juego.Liberar();
+    return esperado;
+}
+
+// ============================================================================
+// PROGRAMA PRINCIPAL
+// ============================================================================
+int main(int argc, char** argv)
+{
+    const char* carpeta = "Sesiones";
+    const char* rutaUmbrales = nullptr;
+    const char* rutaGuardarUmbrales = nullptr;
+    double margen = 0.5;
+    bool generar = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!std::strcmp(argv[i], "--sesiones") && i + 1 < argc) carpeta = argv[++i];
+        else if (!std::strcmp(argv[i], "--umbrales") && i + 1 < argc) rutaUmbrales = argv[++i];
+        else if (!std::strcmp(argv[i], "--guardar-umbrales") && i + 1 < argc) rutaGuardarUmbrales = argv[++i];
+        else if (!std::strcmp(argv[i], "--margen") && i + 1 < argc) margen = std::atof(argv[++i]);
+        else if (!std::strcmp(argv[i], "--generar-sesiones")) generar = true;
+    }
+
+    // --- Generación de las sesiones a partir de los guiones ---
+    if (generar)
+    {
+        for (const Sesion& s : Sesiones)
+        {
+            Guion g;
+            s.Armar(g);
+            std::string ruta = RutaSesion(carpeta, s.Nombre);
+            if (!Entrada::Guardar(ruta.c_str(), g.Frames)) return 2;
+            std::printf("%-12s %6zu frames -> %s\n", s.Nombre, g.Frames.size(), ruta.c_str());
+        }
+    }
+
+    // --- Ventana oculta: contexto GL real sin mostrar nada ni esperar vsync ---
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(1024, 768, "RegresionFrames");
+    Recursos::Cargar();
+    Instanciado::Iniciar();     // Mismo camino de dibujo que el juego (si la GPU lo soporta)
+
+    // Batch propio: el de rlgl es interno y no deja leer su contador
+    rlRenderBatch batch = rlLoadRenderBatch(1, 8192);
+    rlSetRenderBatchActive(&batch);
+    Instanciado::ContarLote(&batch);
+
+    std::vector<ResultadoSesion> resultados;
+    int fallas = 0;
+
+    for (const Sesion& s : Sesiones)
+    {
+        std::vector<EntradaFrame> frames;
+        if (!Entrada::Cargar(RutaSesion(carpeta, s.Nombre).c_str(), frames))
+        {
+            fallas++;
+            continue;
+        }
+
+        ResultadoSesion r;
+        if (!ReproducirSesion(s, frames, r)) fallas++;
+        resultados.push_back(r);
+    }
+
+    Instanciado::ContarLote(nullptr);
+    rlSetRenderBatchActive(nullptr);
+    rlUnloadRenderBatch(batch);
+    Instanciado::Liberar();
+    Recursos::Liberar();
+    CloseWindow();
+
+    // --- Resultados en JSON ---
+    std::printf("{\n  \"sesiones\": [\n");
+    for (size_t i = 0; i < resultados.size(); i++)
+    {
+        const ResultadoSesion& r = resultados[i];
+        std::printf("    { \"sesion\": \"%s\", \"frames\": %d, \"media_ms\": %.3f, \"p95_ms\": %.3f, \"max_ms\": %.3f, \"max_draws\": %d }%s\n",
+            r.Nombre.c_str(), r.Frames, r.MediaMs, r.P95Ms, r.MaxMs, r.MaxDraws,
+            i + 1 < resultados.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+
+    if (rutaGuardarUmbrales && !GuardarUmbrales(rutaGuardarUmbrales, resultados, margen))
+    {
+        std::fprintf(stderr, "No se pudo escribir %s\n", rutaGuardarUmbrales);
+        return 2;
+    }
+
+    // --- Comparación contra los umbrales ---
+    if (rutaUmbrales)
+    {
+        std::vector<UmbralSesion> umbrales;
+        if (!LeerUmbrales(rutaUmbrales, umbrales))
+        {
+            std::fprintf(stderr, "No se pudieron leer los umbrales %s\n", rutaUmbrales);
+            return 2;
+        }
+
+        for (const ResultadoSesion& r : resultados)
+        {
+            for (const UmbralSesion& u : umbrales)
+            {
+                if (u.Nombre != r.Nombre) continue;
+
+                bool tiempoMal = u.P95Ms > 0 && r.P95Ms > u.P95Ms;
+                bool drawsMal = r.MaxDraws > u.MaxDraws;
+                if (tiempoMal || drawsMal) fallas++;
+
+                char umbralTiempo[16];
+                if (u.P95Ms > 0) std::snprintf(umbralTiempo, sizeof(umbralTiempo), "%7.3f", u.P95Ms);
+                else std::snprintf(umbralTiempo, sizeof(umbralTiempo), "%7s", "-");
+
+                std::fprintf(stderr, "%-12s p95 %7.3f ms (umbral %s)  draws %4d (umbral %4d)%s\n",
+                    r.Nombre.c_str(), r.P95Ms, umbralTiempo, r.MaxDraws, u.MaxDraws,
+                    tiempoMal || drawsMal ? "  <-- REGRESION" : "");
+            }
+        }
+    }
+
+    return fallas > 0 ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+﻿#include "Resistencia.hpp"
+#include "Recursos.hpp"
+#include "MemoriaProceso.hpp"
+#include "raylib.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+// ============================================================================
+// MUESTRAS
+// ============================================================================
+struct MuestraResistencia
+{
+    double Segundos;            // Desde Iniciar
+    long long Frames;
+    size_t Memoria;
+    int Vivos[REC_CANTIDAD];
+    float MediaMs;              // Tiempo de CPU por frame en la ventana
+    float P95Ms;
+    float MaxMs;
+};
+
+static FILE* Informe = nullptr;
+static double Inicio = 0;
+static double Duracion = 0;     // Segundos (0: sin límite)
+static double Intervalo = 30;
+static double ProximaMuestra = 0;
+static long long Frames = 0;
+
+static std::vector<float> VentanaMs;    // Frames desde la última muestra
+static MuestraResistencia Base;         // Primera muestra (contra ella se mide la deriva)
+static MuestraResistencia Ultima;
+static int Muestras = 0;
+
+static const double BytesPorMB = 1024.0 * 1024.0;
+
+static void TomarMuestra(const Bot& bot)
+{
+    MuestraResistencia m = {};
+    m.Segundos = GetTime() - Inicio;
+    m.Frames = Frames;
+    m.Memoria = MemoriaProceso();
+    for (int t = 0; t < REC_CANTIDAD; t++) m.Vivos[t] = Recursos::Vivos((TipoRecurso)t);
+
+    if (!VentanaMs.empty())
+    {
+        double suma = 0;
+        for (float ms : VentanaMs) suma += ms;
+        m.MediaMs = (float)(suma / VentanaMs.size());
+        m.MaxMs = *std::max_element(VentanaMs.begin(), VentanaMs.end());
+
+        size_t k = VentanaMs.size() * 95 / 100;
+        std::nth_element(VentanaMs.begin(), VentanaMs.begin() + k, VentanaMs.end());
+        m.P95Ms = VentanaMs[k];
+    }
+    VentanaMs.clear();
+
+    if (Muestras == 0) Base = m;
+
+    // Un recurso vivo de más o de menos ya es una fuga (o una doble liberación)
+    for (int t = 0; Muestras > 0 && t < REC_CANTIDAD; t++)
+        if (m.Vivos[t] != Ultima.Vivos[t])
+            TraceLog(LOG_WARNING, "RESISTENCIA: recursos vivos de tipo %i: %i -> %i (%.0f s)",
+                t, Ultima.Vivos[t], m.Vivos[t], m.Segundos);
+
+    float deriva = Base.MediaMs > 0 ? (m.MediaMs / Base.MediaMs - 1.0f) * 100.0f : 0.0f;
+
+    if (Informe)
+    {
+        std::fprintf(Informe, "%.1f,%lld,%.2f,%i,%i,%i,%.3f,%.3f,%.3f,%.1f,%i,%i,%i,%i\n",
+            m.Segundos, m.Frames, m.Memoria / BytesPorMB,
+            m.Vivos[REC_TEXTURA], m.Vivos[REC_MALLA], m.Vivos[REC_SONIDO],
+            m.MediaMs, m.P95Ms, m.MaxMs, deriva,
+            bot.Partidas, bot.Victorias, bot.Derrotas, bot.Reinicios);
+        std::fflush(Informe);   // Si el proceso muere a las 5 horas, lo medido queda
+    }
+
+    Ultima = m;
+    Muestras++;
+}
+
+// ============================================================================
+// INTERFAZ PÚBLICA
+// ============================================================================
+bool Resistencia::Iniciar(const char* rutaInforme, float minutos, float segundosEntreMuestras)
+{
+    Informe = std::fopen(rutaInforme, "w");
+    if (!Informe)
+    {
+        TraceLog(LOG_WARNING, "RESISTENCIA: no se pudo escribir %s", rutaInforme);
+        return false;
+    }
+
+    std::fprintf(Informe, "segundos,frames,memoria_mb,texturas,mallas,sonidos,"
+        "frame_media_ms,frame_p95_ms,frame_max_ms,deriva_pct,partidas,victorias,derrotas,reinicios\n");
+
+    Inicio = GetTime();
+    Duracion = minutos * 60.0;
+    Intervalo = segundosEntreMuestras;
+    ProximaMuestra = Intervalo;
+    Frames = 0;
+    Muestras = 0;
+    VentanaMs.clear();
+    VentanaMs.reserve((size_t)(Intervalo * 60 * 2));
+
+    TraceLog(LOG_INFO, "RESISTENCIA: muestras cada %.0f s en %s", Intervalo, rutaInforme);
+    return true;
+}
+
+bool Resistencia::Frame(double ms, const Bot& bot)
+{
+    Frames++;
+    VentanaMs.push_back((float)ms);
+
+    double ahora = GetTime() - Inicio;
+    if (ahora >= ProximaMuestra)
+    {
+        TomarMuestra(bot);
+        ProximaMuestra += Intervalo;
+    }
+
+    return Duracion <= 0 || ahora < Duracion;
+}
+
+void Resistencia::Terminar(const Bot& bot)
+{
+    if (!VentanaMs.empty() || Muestras == 0) TomarMuestra(bot);
+
+    double horas = (Ultima.Segundos - Base.Segundos) / 3600.0;
+    double crecimiento = ((double)Ultima.Memoria - (double)Base.Memoria) / BytesPorMB;
+
+    TraceLog(LOG_INFO, "RESISTENCIA: %.1f min, %lld frames, %i partidas (%i ganadas, %i perdidas, %i reinicios)",
+        Ultima.Segundos / 60.0, Ultima.Frames, bot.Partidas, bot.Victorias, bot.Derrotas, bot.Reinicios);
+    TraceLog(LOG_INFO, "RESISTENCIA: memoria %.2f -> %.2f MB (%.2f MB/h)",
+        Base.Memoria / BytesPorMB, Ultima.Memoria / BytesPorMB, horas > 0 ? crecimiento / horas : 0.0);
+    TraceLog(LOG_INFO, "RESISTENCIA: texturas %i -> %i, mallas %i -> %i, sonidos %i -> %i",
+        Base.Vivos[REC_TEXTURA], Ultima.Vivos[REC_TEXTURA], Base.Vivos[REC_MALLA], Ultima.Vivos[REC_MALLA],
+        Base.Vivos[REC_SONIDO], Ultima.Vivos[REC_SONIDO]);
+    TraceLog(LOG_INFO, "RESISTENCIA: frame medio %.3f -> %.3f ms, p95 %.3f -> %.3f ms",
+        Base.MediaMs, Ultima.MediaMs, Base.P95Ms, Ultima.P95Ms);
+
+    if (Informe) std::fclose(Informe);
+    Informe = nullptr;
+}
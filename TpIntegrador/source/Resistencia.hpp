@@ -0,0 +1,27 @@
+﻿#pragma once
+#include "Bot.hpp"
+
+// ============================================================================
+// PRUEBA DE RESISTENCIA (SOAK)
+// ============================================================================
+// Acompaña al bot durante horas y cada tanto toma una muestra de:
+//   - memoria del proceso (MemoriaProceso)
+//   - texturas, mallas y sonidos vivos (Recursos::Vivos)
+//   - tiempo de CPU por frame en la ventana: media, p95 y máximo, y la
+//     deriva de la media respecto de la primera ventana
+// Cada muestra es una línea del informe CSV; al terminar se informa por
+// consola cuánto creció cada cosa (la memoria, por hora).
+// ============================================================================
+namespace Resistencia
+{
+    // Abre el informe. minutos = 0: hasta que se cierre la ventana.
+    bool Iniciar(const char* rutaInforme, float minutos, float segundosEntreMuestras = 30.0f);
+
+    // Va una vez por frame con su tiempo de CPU (actualizar + dibujar +
+    // EndDrawing, sin la espera del ritmo). Devuelve false cuando se
+    // cumplió el tiempo pedido.
+    bool Frame(double ms, const Bot& bot);
+
+    // Última muestra, resumen por consola y cierre del informe
+    void Terminar(const Bot& bot);
+}
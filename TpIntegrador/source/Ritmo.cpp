@@ -0,0 +1,155 @@
+﻿#include "Ritmo.hpp"
+#include "Entrada.hpp"
+#include "raylib.h"
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+using Reloj = std::chrono::steady_clock;
+using Segundos = std::chrono::duration<double>;
+
+// ============================================================================
+// ESTADO
+// ============================================================================
+static double PeriodoActivo = 1.0 / 60.0;
+static double PeriodoReposo = 1.0 / 10.0;
+
+static Reloj::time_point InicioFrame;       // Comienzo del frame en curso
+static float DtFrame = 1.0f / 60.0f;
+
+// Cuánto antes del objetivo se deja de dormir para esperar activamente.
+// Empieza holgado y se ajusta con lo que se pasa cada sleep.
+static double Margen = 0.002;
+const double MargenMin = 0.0002;
+const double MargenMax = 0.004;
+
+// Tramo de sleep en reposo (cada cuánto se mira si hubo entrada)
+const double TramoReposo = 0.004;
+
+// Ventana móvil de períodos de frames activos
+const int VentanaJitter = 120;
+static float Periodos[VentanaJitter];
+static int NumPeriodos = 0;
+static int SiguientePeriodo = 0;
+static int FramesReposo = 0;
+
+// ============================================================================
+// ESPERAS
+// ============================================================================
+static double Transcurrido(Reloj::time_point desde)
+{
+    return Segundos(Reloj::now() - desde).count();
+}
+
+// Duerme 'segundos' y aprende del exceso del sistema
+static void Dormir(double segundos)
+{
+    if (segundos <= 0) return;
+
+    Reloj::time_point antes = Reloj::now();
+    std::this_thread::sleep_for(Segundos(segundos));
+    double exceso = Transcurrido(antes) - segundos;
+
+    // Sube enseguida si el sleep se pasó; baja de a poco si sobra margen
+    Margen = exceso > Margen ? exceso : Margen * 0.995 + exceso * 0.005;
+    if (Margen < MargenMin) Margen = MargenMin;
+    if (Margen > MargenMax) Margen = MargenMax;
+}
+
+// Sleep hasta 'Margen' antes del objetivo y espera activa el resto
+static void EsperarHasta(Reloj::time_point objetivo)
+{
+    Dormir(Segundos(objetivo - Reloj::now()).count() - Margen);
+    while (Reloj::now() < objetivo)
+        std::this_thread::yield();
+}
+
+// En reposo se duerme en tramos y se mira la entrada entre uno y otro.
+// La entrada se mira antes de sondear: PollInputEvents() pisa los flancos
+// (IsKeyPressed) del sondeo anterior, y el de EndDrawing() ya puede tener uno.
+static void EsperarReposo(Reloj::time_point objetivo)
+{
+    while (!Entrada::HayActividad() && !WindowShouldClose())
+    {
+        double restante = Segundos(objetivo - Reloj::now()).count();
+        if (restante <= 0) return;
+
+        Dormir(restante < TramoReposo ? restante : TramoReposo);
+        PollInputEvents();
+    }
+}
+
+// ============================================================================
+// API
+// ============================================================================
+void Ritmo::Iniciar(int fpsActivo, int fpsReposo)
+{
+    PeriodoActivo = 1.0 / fpsActivo;
+    PeriodoReposo = 1.0 / fpsReposo;
+    DtFrame = (float)PeriodoActivo;
+    NumPeriodos = SiguientePeriodo = FramesReposo = 0;
+
+    SetTargetFPS(0);    // raylib ya no espera en EndDrawing: espera Ritmo
+    InicioFrame = Reloj::now();
+}
+
+void Ritmo::EsperarProximoFrame(bool reposo)
+{
+    if (reposo)
+    {
+        EsperarReposo(InicioFrame + std::chrono::duration_cast<Reloj::duration>(Segundos(PeriodoReposo)));
+        FramesReposo++;
+
+        // El tiempo quieto no es tiempo de juego
+        DtFrame = (float)PeriodoActivo;
+        InicioFrame = Reloj::now();
+        return;
+    }
+
+    Reloj::time_point objetivo = InicioFrame + std::chrono::duration_cast<Reloj::duration>(Segundos(PeriodoActivo));
+    EsperarHasta(objetivo);
+
+    // Si el frame se atrasó, el próximo arranca ahora (no se intenta recuperar)
+    Reloj::time_point ahora = Reloj::now();
+    double periodo = Segundos(ahora - InicioFrame).count();
+    InicioFrame = ahora;
+    DtFrame = (float)periodo;
+
+    Periodos[SiguientePeriodo] = (float)periodo;
+    SiguientePeriodo = (SiguientePeriodo + 1) % VentanaJitter;
+    if (NumPeriodos < VentanaJitter) NumPeriodos++;
+}
+
+float Ritmo::Dt()
+{
+    return DtFrame;
+}
+
+Ritmo::Estadisticas Ritmo::ObtenerEstadisticas()
+{
+    Estadisticas e = {};
+    e.Frames = NumPeriodos;
+    e.FramesReposo = FramesReposo;
+    if (NumPeriodos == 0) return e;
+
+    double suma = 0, sumaJitter = 0, peor = 0;
+    for (int i = 0; i < NumPeriodos; i++)
+    {
+        double desvio = std::fabs(Periodos[i] - PeriodoActivo);
+        suma += Periodos[i];
+        sumaJitter += desvio;
+        if (desvio > peor) peor = desvio;
+    }
+
+    e.PeriodoMedioMs = (float)(suma / NumPeriodos * 1000.0);
+    e.JitterMedioMs = (float)(sumaJitter / NumPeriodos * 1000.0);
+    e.JitterMaxMs = (float)(peor * 1000.0);
+    return e;
+}
+
+void Ritmo::Reportar()
+{
+    Estadisticas e = ObtenerEstadisticas();
+    TraceLog(LOG_INFO, "RITMO: %i frames activos, periodo medio %.3f ms, jitter medio %.3f ms (peor %.3f ms), %i frames en reposo",
+        e.Frames, e.PeriodoMedioMs, e.JitterMedioMs, e.JitterMaxMs, e.FramesReposo);
+}
@@ -0,0 +1,44 @@
+﻿#pragma once
+
+// ============================================================================
+// RITMO DE FRAMES
+// ============================================================================
+// Reemplaza a SetTargetFPS: al terminar cada frame duerme hasta poco antes
+// del próximo y completa el resto con una espera activa corta, así el
+// período real queda cerca del objetivo sin depender de la resolución del
+// sleep del sistema. El margen de la espera activa se ajusta solo según
+// cuánto se pasó el sleep en los últimos frames.
+//
+// En reposo (pantallas quietas: MENU, GANASTE, PERDISTE) el período pasa a
+// ser el de fpsReposo, pero la espera se hace en tramos cortos y se corta
+// apenas hay entrada (Entrada::HayActividad): el frame que responde no
+// tiene que esperar el período largo.
+// ============================================================================
+namespace Ritmo
+{
+    // Frames por segundo jugando y en reposo
+    void Iniciar(int fpsActivo = 60, int fpsReposo = 10);
+
+    // Va después de EndDrawing(): espera hasta el comienzo del próximo frame
+    void EsperarProximoFrame(bool reposo);
+
+    // Segundos de juego del frame que empieza. Lo esperado en reposo no
+    // cuenta (el primer frame después de una pantalla quieta no da un salto).
+    float Dt();
+
+    // Jitter medido sobre los últimos frames activos: diferencia entre el
+    // período real y el objetivo
+    struct Estadisticas
+    {
+        int Frames;             // Frames activos medidos (ventana móvil)
+        float PeriodoMedioMs;
+        float JitterMedioMs;    // Promedio de |período - objetivo|
+        float JitterMaxMs;      // Peor desvío de la ventana
+        int FramesReposo;       // Frames en reposo desde Iniciar()
+    };
+
+    Estadisticas ObtenerEstadisticas();
+
+    // Informa las estadísticas por consola
+    void Reportar();
+}
@@ -0,0 +1,80 @@
+﻿#include "Simulacion.hpp"
+#include "Nivel.hpp"
+#include "Player.hpp"
+#include "Puerta.hpp"
+#include "Eventos.hpp"
+
+// Pies del jugador (donde se ven el salto y el aterrizaje)
+static Vector2 PiesJugador(const Player& jugador)
+{
+    Rectangle r = jugador.GetRect();
+    return { r.x + r.width / 2, r.y + r.height };
+}
+
+// ============================================================================
+// UN TICK
+// ============================================================================
+ResultadoTick SimularTick(Nivel& nivel, Player& jugador, Puerta& puerta,
+                          float& tiempoJugado, const EntradaFrame& entrada,
+                          ColaEventos* eventos)
+{
+    ResultadoTick r;
+
+    // Las plataformas móviles van antes que el jugador: la física ya ve
+    // dónde quedaron y cuánto lleva a quien está parado encima
+    ActualizarPlataformasMoviles(nivel, DtTick);
+
+    // Física del jugador y apertura de la puerta
+    bool estabaEnSuelo = jugador.Fisica.EnSuelo != 0;
+    r.SucesosJugador = jugador.Update(DtTick, Entrada::Jugador(entrada), nivel);
+
+    int disparadores[4];
+    int numDisparadores = ConsultarMundo(nivel.Mundo, jugador.GetRect(), COL_DISPARADOR, disparadores, 4);
+    bool cercaPuerta = false;
+    for (int k = 0; k < numDisparadores; k++)
+        if (nivel.Mundo.Datos[disparadores[k]] == DISPARADOR_PUERTA) cercaPuerta = true;
+
+    puerta.IntAbrir(cercaPuerta, entrada.Mouse, Pulsado(entrada, ENT_CLICK));
+
+    tiempoJugado += DtTick;
+
+    // Murciélagos (y sus colisionadores) antes de las reglas; los que pican
+    // miran dónde quedó el jugador en este tick
+    Rectangle rj = jugador.GetRect();
+    Vector2 centro = { rj.x + rj.width / 2, rj.y + rj.height / 2 };
+    ActualizarEnemigos(nivel, DtTick, centro);
+
+    r.Victoria = puerta.EstaAbierta;
+    r.Derrota = ComprobarDerrota(jugador.Fisica, nivel, tiempoJugado);
+
+    if (eventos)
+    {
+        unsigned char suelo = jugador.Fisica.TipoActual;
+        Vector2 pies = PiesJugador(jugador);
+
+        if (r.SucesosJugador & PASO_SALTO) PublicarEvento(*eventos, EV_SALTO, suelo, pies);
+        if (r.SucesosJugador & PASO_PISADA) PublicarEvento(*eventos, EV_PISADA, suelo, pies);
+        if (!estabaEnSuelo && jugador.Fisica.EnSuelo) PublicarEvento(*eventos, EV_ATERRIZAJE, suelo, pies);
+        // Si en el mismo tick se abre la puerta y se pierde, gana la derrota
+        // (como en Juego::FrameJugando): solo suena una de las dos
+        if (r.Victoria && r.Derrota == SIN_PERDIDA) PublicarEvento(*eventos, EV_VICTORIA, 0, entrada.Mouse);
+        if (r.Derrota != SIN_PERDIDA) PublicarEvento(*eventos, EV_DERROTA, (unsigned char)r.Derrota, centro);
+    }
+
+    return r;
+}
+
+// ============================================================================
+// VARIOS TICKS SEGUIDOS (REBOBINADO, FANTASMAS, BENCHMARK)
+// ============================================================================
+int Resimular(Nivel& nivel, Player& jugador, Puerta& puerta, float& tiempoJugado,
+              const EntradaFrame* entradas, int cantidad)
+{
+    for (int i = 0; i < cantidad; i++)
+    {
+        ResultadoTick r = SimularTick(nivel, jugador, puerta, tiempoJugado, entradas[i]);
+        if (r.Victoria || r.Derrota != SIN_PERDIDA) return i + 1;
+    }
+
+    return cantidad;
+}
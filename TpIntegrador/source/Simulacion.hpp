@@ -0,0 +1,59 @@
+﻿#pragma once
+#include "Entrada.hpp"
+#include "Reglas.hpp"
+
+struct Nivel;
+class Player;
+class Puerta;
+
+// ============================================================================
+// SIMULACIÓN DETERMINISTA
+// ============================================================================
+// La partida avanza en ticks de duración fija (DtTick), sin importar los
+// FPS reales: Juego acumula el dt de cada frame y corre los ticks que
+// entren. Un tick depende solo del estado (Nivel, Player, Puerta, tiempo)
+// y de la EntradaFrame que recibe: no lee raylib, no mira el reloj y no
+// dispara sonidos (publica eventos, si quien llama le pasa una cola).
+// Así se puede volver a simular desde una InstantaneaPartida y llegar a
+// los mismos bits.
+//
+// Política de punto flotante:
+//   - Solo float, compilado con /fp:precise (fijado en los .vcxproj) y
+//     SSE2: nada de /fp:fast ni de x87.
+//   - Dentro del tick solo operaciones con redondeo exacto IEEE (+ - * /,
+//     sqrt, fmod). Nada de sin/cos/pow: cambian entre versiones de la CRT.
+//   - El dt de un tick es siempre DtTick. El dt del frame solo decide
+//     cuántos ticks corren, nunca entra en las cuentas.
+//   - Nada de memoria sin inicializar en el estado (las instantáneas se
+//     comparan con memcmp).
+// Se garantiza: mismo ejecutable + mismo estado + misma entrada = mismo
+// estado. Entre compiladores o plataformas distintas no se promete nada.
+// ============================================================================
+const float DtTick = 1.0f / 60.0f;
+
+// Si un frame trae más atraso que esto, el resto se descarta: el juego se
+// enlentece en lugar de caer en una espiral de ticks atrasados
+const int MaxTicksPorFrame = 4;
+
+struct ColaEventos;
+
+struct ResultadoTick
+{
+    unsigned char SucesosJugador;   // SucesoPaso del jugador en este tick
+    bool Victoria;                  // La puerta quedó abierta
+    MotivoPerdida Derrota;          // SIN_PERDIDA si la partida sigue
+};
+
+// Un tick: plataformas móviles, jugador, puerta, tiempo, murciélagos y
+// reglas, en ese orden. Los "Pulso" de la entrada valen para este tick.
+// Con 'eventos' publica ahí lo que pasó (saltos, pisadas, aterrizajes,
+// victoria, derrota); sin cola (re-simulación, verificador, benchmark) no
+// hay efectos. La cola no cambia nada de la simulación.
+ResultadoTick SimularTick(Nivel& nivel, Player& jugador, Puerta& puerta,
+                          float& tiempoJugado, const EntradaFrame& entrada,
+                          ColaEventos* eventos = nullptr);
+
+// Corre hasta 'cantidad' ticks con entradas[i] (Dt no se usa) y corta en
+// el primero que termina la partida. Devuelve cuántos corrió.
+int Resimular(Nivel& nivel, Player& jugador, Puerta& puerta, float& tiempoJugado,
+              const EntradaFrame* entradas, int cantidad);